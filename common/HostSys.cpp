@@ -108,6 +108,55 @@ static u32 GetSpinTime()
 
 const u32 SPIN_TIME_NS = GetSpinTime();
 
+MirroredMemory::~MirroredMemory()
+{
+	Free();
+}
+
+bool MirroredMemory::Allocate(const char* name, size_t size)
+{
+	Free();
+
+	m_handle = HostSys::CreateSharedMemory(HostSys::GetFileMappingName(name).c_str(), size);
+	if (!m_handle)
+		return false;
+
+	m_area = SharedMemoryMappingArea::Create(size * NUM_VIEWS);
+	if (!m_area)
+	{
+		Free();
+		return false;
+	}
+
+	m_size = size;
+	for (; m_num_views < NUM_VIEWS; m_num_views++)
+	{
+		if (!m_area->Map(m_handle, 0, m_area->OffsetPointer(m_num_views * size), size, PageAccess_ReadWrite()))
+		{
+			Console.Error("Failed to map view %u of mirrored memory '%s'", m_num_views, name);
+			Free();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void MirroredMemory::Free()
+{
+	for (; m_num_views > 0; m_num_views--)
+		m_area->Unmap(m_area->OffsetPointer((m_num_views - 1) * m_size), m_size);
+
+	m_area.reset();
+	m_size = 0;
+
+	if (m_handle)
+	{
+		HostSys::DestroySharedMemory(m_handle);
+		m_handle = nullptr;
+	}
+}
+
 #ifdef __APPLE__
 // https://alastairs-place.net/blog/2013/01/10/interesting-os-x-crash-report-tidbits/
 // https://opensource.apple.com/source/WebKit2/WebKit2-7608.3.10.0.3/Platform/spi/Cocoa/CrashReporterClientSPI.h.auto.html
@@ -177,6 +177,31 @@ private:
 #endif
 };
 
+/// Shared memory which is mapped twice, back to back, so that accesses running off the end of the buffer
+/// continue at its start. Ring buffers can then hand out contiguous pointers for data which wraps around.
+class MirroredMemory
+{
+public:
+	MirroredMemory() = default;
+	~MirroredMemory();
+
+	/// Size must be a multiple of the allocation granularity (64KB on Windows).
+	bool Allocate(const char* name, size_t size);
+	void Free();
+
+	__fi bool IsValid() const { return (m_num_views == NUM_VIEWS); }
+	__fi u8* GetPointer() const { return m_area ? m_area->BasePointer() : nullptr; }
+	__fi size_t GetSize() const { return m_size; }
+
+private:
+	static constexpr u32 NUM_VIEWS = 2;
+
+	std::unique_ptr<SharedMemoryMappingArea> m_area;
+	void* m_handle = nullptr;
+	size_t m_size = 0;
+	u32 m_num_views = 0;
+};
+
 extern u64 GetTickFrequency();
 extern u64 GetCPUTicks();
 extern u64 GetPhysicalMemory();
@@ -103,6 +103,20 @@ namespace Perf
 		u64 code_index;
 		// name
 	};
+	struct JITDUMP_DEBUG_INFO
+	{
+		JITDUMP_RECORD_HEADER header;
+		u64 code_addr;
+		u64 nr_entry;
+		// entries
+	};
+	struct JITDUMP_DEBUG_ENTRY
+	{
+		u64 addr;
+		s32 lineno;
+		s32 discrim;
+		// name
+	};
 #pragma pack(pop)
 
 	static u64 JitDumpTimestamp()
@@ -117,38 +131,91 @@ namespace Perf
 	static std::mutex s_jitdump_mutex;
 	static u32 s_jitdump_record_id;
 
-	static void RegisterMethod(const void* ptr, size_t size, const char* symbol)
+	static bool OpenJitDump()
 	{
-		const u32 namelen = std::strlen(symbol) + 1;
+		if (s_jitdump_file)
+			return true;
+		if (s_jitdump_file_opened)
+			return false;
 
-		std::unique_lock lock(s_jitdump_mutex);
+		char file[256];
+		snprintf(file, std::size(file), "jit-%d.dump", getpid());
+		s_jitdump_file = fopen(file, "w+b");
+		s_jitdump_file_opened = true;
 		if (!s_jitdump_file)
-		{
-			if (!s_jitdump_file_opened)
-			{
-				char file[256];
-				snprintf(file, std::size(file), "jit-%d.dump", getpid());
-				s_jitdump_file = fopen(file, "w+b");
-				s_jitdump_file_opened = true;
-				if (!s_jitdump_file)
-					return;
-			}
-
-			void* perf_marker = mmap(nullptr, 4096, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(s_jitdump_file), 0);
-			pxAssertRel(perf_marker != MAP_FAILED, "Map perf marker");
-
-			JITDUMP_HEADER jh = {};
+			return false;
+
+		void* perf_marker = mmap(nullptr, 4096, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(s_jitdump_file), 0);
+		pxAssertRel(perf_marker != MAP_FAILED, "Map perf marker");
+
+		JITDUMP_HEADER jh = {};
 #if defined(_M_X86)
-			jh.elf_mach = EM_X86_64;
+		jh.elf_mach = EM_X86_64;
 #elif defined(_M_ARM64)
-			jh.elf_mach = EM_AARCH64;
+		jh.elf_mach = EM_AARCH64;
 #else
 #error Unhandled architecture.
 #endif
-			jh.pid = getpid();
-			jh.timestamp = JitDumpTimestamp();
-			std::fwrite(&jh, sizeof(jh), 1, s_jitdump_file);
+		jh.pid = getpid();
+		jh.timestamp = JitDumpTimestamp();
+		std::fwrite(&jh, sizeof(jh), 1, s_jitdump_file);
+		return true;
+	}
+
+	// Debug info has to be written before the code load record it describes. perf turns each entry
+	// into a line table row, so we use the group prefix as the "file name" and the (physical, for kseg0/1) guest
+	// PC as the "line number", which makes `perf annotate` show guest addresses next to the host instructions.
+	static void WriteDebugInfo(const void* ptr, size_t size, const char* source, const PCMap& map)
+	{
+		const uptr start = reinterpret_cast<uptr>(ptr);
+		const uptr end = start + size;
+		const u32 namelen = std::strlen(source) + 1;
+
+		u64 count = 0;
+		for (const PCMap::Entry& entry : map.GetEntries())
+		{
+			const uptr host = reinterpret_cast<uptr>(entry.host);
+			count += (host >= start && host < end);
+		}
+		if (count == 0)
+			return;
+
+		JITDUMP_DEBUG_INFO di = {};
+		di.header.id = JIT_CODE_DEBUG_INFO;
+		di.header.total_size = sizeof(di) + static_cast<u32>(count * (sizeof(JITDUMP_DEBUG_ENTRY) + namelen));
+		di.header.timestamp = JitDumpTimestamp();
+		di.code_addr = static_cast<u64>(start);
+		di.nr_entry = count;
+		std::fwrite(&di, sizeof(di), 1, s_jitdump_file);
+
+		for (const PCMap::Entry& entry : map.GetEntries())
+		{
+			const uptr host = reinterpret_cast<uptr>(entry.host);
+			if (host < start || host >= end)
+				continue;
+
+			JITDUMP_DEBUG_ENTRY de = {};
+			de.addr = static_cast<u64>(host);
+			// Line numbers are signed. kseg0/kseg1 are direct mapped, so drop the segment bits to keep those
+			// positive, kuseg is below 0x80000000 anyway. That just leaves kseg2/3, which games don't run code from.
+			const u32 line = ((entry.pc >> 30) == 2) ? (entry.pc & 0x1fffffffu) : (entry.pc & 0x7fffffffu);
+			de.lineno = static_cast<s32>(line);
+			de.discrim = 0;
+			std::fwrite(&de, sizeof(de), 1, s_jitdump_file);
+			std::fwrite(source, namelen, 1, s_jitdump_file);
 		}
+	}
+
+	static void RegisterMethod(const void* ptr, size_t size, const char* symbol, const char* source = nullptr, const PCMap* map = nullptr)
+	{
+		const u32 namelen = std::strlen(symbol) + 1;
+
+		std::unique_lock lock(s_jitdump_mutex);
+		if (!OpenJitDump())
+			return;
+
+		if (map && !map->IsEmpty())
+			WriteDebugInfo(ptr, size, (source && source[0]) ? source : "guest", *map);
 
 		JITDUMP_CODE_LOAD cl = {};
 		cl.header.id = JIT_CODE_LOAD;
@@ -165,6 +232,11 @@ namespace Perf
 		std::fwrite(ptr, size, 1, s_jitdump_file);
 		std::fflush(s_jitdump_file);
 	}
+
+	bool IsPCMapEnabled()
+	{
+		return true;
+	}
 #elif defined(ENABLE_VTUNE)
 	static void RegisterMethod(const void* ptr, size_t size, const char* symbol)
 	{
@@ -177,6 +249,19 @@ namespace Perf
 	}
 #endif
 
+#if !defined(__linux__) || !defined(ProfileWithPerfJitDump)
+	bool IsPCMapEnabled()
+	{
+		return false;
+	}
+#endif
+
+	void PCMap::Add(const void* host, u32 pc)
+	{
+		if (IsPCMapEnabled())
+			m_entries.push_back({host, pc});
+	}
+
 #if (defined(__linux__) && (defined(ProfileWithPerf) || defined(ProfileWithPerfJitDump))) || defined(ENABLE_VTUNE)
 	void Group::Register(const void* ptr, size_t size, const char* symbol)
 	{
@@ -198,6 +283,20 @@ namespace Perf
 		RegisterMethod(ptr, size, full_symbol);
 	}
 
+	void Group::RegisterPC(const void* ptr, size_t size, u32 pc, const PCMap& map)
+	{
+#if defined(__linux__) && defined(ProfileWithPerfJitDump)
+		char full_symbol[128];
+		if (HasPrefix())
+			std::snprintf(full_symbol, std::size(full_symbol), "%s_%08X", m_prefix, pc);
+		else
+			std::snprintf(full_symbol, std::size(full_symbol), "%08X", pc);
+		RegisterMethod(ptr, size, full_symbol, m_prefix, &map);
+#else
+		RegisterPC(ptr, size, pc);
+#endif
+	}
+
 	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key)
 	{
 		char full_symbol[128];
@@ -210,6 +309,7 @@ namespace Perf
 #else
 	void Group::Register(const void* ptr, size_t size, const char* symbol) {}
 	void Group::RegisterPC(const void* ptr, size_t size, u32 pc) {}
+	void Group::RegisterPC(const void* ptr, size_t size, u32 pc, const PCMap& map) {}
 	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key) {}
 #endif
 } // namespace Perf
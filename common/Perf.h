@@ -9,6 +9,31 @@
 
 namespace Perf
 {
+	/// Records the host code address each guest instruction was emitted at while a block is being
+	/// compiled. When jitdump output is enabled, this is written as debug info alongside the code,
+	/// so `perf inject --jit` can attribute samples inside a block to individual guest PCs.
+	class PCMap
+	{
+	public:
+		struct Entry
+		{
+			const void* host;
+			u32 pc;
+		};
+
+		void Clear() { m_entries.clear(); }
+		void Add(const void* host, u32 pc);
+
+		bool IsEmpty() const { return m_entries.empty(); }
+		const std::vector<Entry>& GetEntries() const { return m_entries; }
+
+	private:
+		std::vector<Entry> m_entries;
+	};
+
+	/// Returns true if the active profiling backend can make use of guest PC mappings.
+	bool IsPCMapEnabled();
+
 	class Group
 	{
 		const char* m_prefix;
@@ -19,6 +44,7 @@ namespace Perf
 
 		void Register(const void* ptr, size_t size, const char* symbol);
 		void RegisterPC(const void* ptr, size_t size, u32 pc);
+		void RegisterPC(const void* ptr, size_t size, u32 pc, const PCMap& map);
 		void RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key);
 	};
 
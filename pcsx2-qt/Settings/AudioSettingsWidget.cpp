@@ -56,6 +56,12 @@ AudioSettingsWidget::AudioSettingsWidget(SettingsWindow* dialog, QWidget* parent
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.outputLatencyMS, "SPU2/Output", "OutputLatencyMS",
 		AudioStreamParameters::DEFAULT_OUTPUT_LATENCY_MS);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.outputLatencyMinimal, "SPU2/Output", "OutputLatencyMinimal", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.blockMixing, "SPU2/Output", "BlockMixing", true);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.threadedMixing, "SPU2/Output", "ThreadedMixing", false);
+	connect(m_ui.blockMixing, &QCheckBox::checkStateChanged, this, [this]() {
+		m_ui.threadedMixing->setEnabled(m_dialog->getEffectiveBoolValue("SPU2/Output", "BlockMixing", true));
+	});
+	m_ui.threadedMixing->setEnabled(m_dialog->getEffectiveBoolValue("SPU2/Output", "BlockMixing", true));
 	connect(m_ui.audioBackend, &QComboBox::currentIndexChanged, this, &AudioSettingsWidget::updateDriverNames);
 	connect(m_ui.expansionMode, &QComboBox::currentIndexChanged, this, &AudioSettingsWidget::onExpansionModeChanged);
 	connect(m_ui.expansionSettings, &QToolButton::clicked, this, &AudioSettingsWidget::onExpansionSettingsClicked);
@@ -110,6 +116,12 @@ AudioSettingsWidget::AudioSettingsWidget(SettingsWindow* dialog, QWidget* parent
 		tr("Controls the volume of the audio played on the host when fast forwarding."));
 	dialog->registerWidgetHelp(m_ui.muted, tr("Mute All Sound"), tr("Unchecked"),
 		tr("Prevents the emulator from producing any audible sound."));
+	dialog->registerWidgetHelp(m_ui.blockMixing, tr("Mix in Blocks"), tr("Checked"),
+		tr("Lets the SPU2 mix several samples at a time while games aren't waiting on audio interrupts or DMAs. Register "
+		   "writes are replayed at the sample they were made on, so the output is the same."));
+	dialog->registerWidgetHelp(m_ui.threadedMixing, tr("Mix on Separate Thread"), tr("Unchecked"),
+		tr("Mixes the blocks from Mix in Blocks on a separate thread, while the emulated CPUs carry on. Can improve "
+		   "performance on CPUs with spare cores."));
 	dialog->registerWidgetHelp(m_ui.expansionMode, tr("Expansion Mode"), tr("Disabled (Stereo)"),
 		tr("Determines how audio is expanded from stereo to surround for supported games. This "
 		   "includes games that support Dolby Pro Logic/Pro Logic II."));
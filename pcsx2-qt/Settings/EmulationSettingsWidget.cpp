@@ -42,8 +42,11 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.eeCycleSkipping, "EmuCore/Speedhacks", "EECycleSkip", DEFAULT_EE_CYCLE_SKIP);
 
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.MTVU, "EmuCore/Speedhacks", "vuThread", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.MTIOP, "EmuCore/Speedhacks", "iopThread", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.MTIPU, "EmuCore/Speedhacks", "ipuThread", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.threadPinning, "EmuCore", "EnableThreadPinning", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.fastCDVD, "EmuCore/Speedhacks", "fastCDVD", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.fastLoad, "EmuCore/Speedhacks", "fastLoad", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.precacheCDVD, "EmuCore", "CdvdPrecache", false);
 
 	if (m_dialog->isPerGameSettings())
@@ -119,8 +122,17 @@ EmulationSettingsWidget::EmulationSettingsWidget(SettingsWindow* dialog, QWidget
 	dialog->registerWidgetHelp(m_ui.MTVU, tr("Enable Multithreaded VU1 (MTVU1)"), tr("Checked"),
 		tr("Generally a speedup on CPUs with 4 or more cores. "
 		   "Safe for most games, but a few are incompatible and may hang."));
+	dialog->registerWidgetHelp(m_ui.MTIOP, tr("Enable Multithreaded IOP (Experimental)"), tr("Unchecked"),
+		tr("Runs the I/O processor, along with sound, disc and controller emulation, on its own thread. "
+		   "Can be a speedup on CPUs with many cores, but may cause timing issues in some games."));
+	dialog->registerWidgetHelp(m_ui.MTIPU, tr("Enable Multithreaded IPU (Experimental)"), tr("Unchecked"),
+		tr("Decodes FMVs on their own thread, alongside the Emotion Engine. "
+		   "Can be a speedup in games with heavy video playback, but may cause FMV timing issues in some games."));
 	dialog->registerWidgetHelp(m_ui.fastCDVD, tr("Enable Fast CDVD"), tr("Unchecked"),
 		tr("Fast disc access, less loading times. Check HDLoader compatibility lists for known games that have issues with this."));
+	dialog->registerWidgetHelp(m_ui.fastLoad, tr("Enable Adaptive Fast Loading"), tr("Unchecked"),
+		tr("Shortens disc seek and read times while the game is busy loading, and returns to normal timings when it "
+		   "streams audio or video from the disc. Some games are enabled automatically through the game database."));
 	dialog->registerWidgetHelp(m_ui.precacheCDVD, tr("Enable CDVD Precaching"), tr("Unchecked"),
 		tr("Loads the disc image into RAM before starting the virtual machine. Can reduce stutter on systems with hard drives that "
 		   "have long wake times, but significantly increases boot times."));
@@ -52,6 +52,80 @@ static __fi void SetSCMDResultSize(u8 size) noexcept
 	memset(&cdvd.SCMDResultBuff[0], 0, size);
 }
 
+// Adaptive fast loading. Reads the game issues back to back, with the drive never going idle in between,
+// are taken to be a loading screen with the IOP blocked on them, and get their seek and read times cut.
+// Reads paced like a stream, CDDA, or reads interleaved with a stream put things back to normal.
+static constexpr u32 FAST_LOAD_TIME_DIVISOR = 4;
+static constexpr u32 FAST_LOAD_BACK_TO_BACK_READS = 4;
+static constexpr u32 FAST_LOAD_COOLDOWN_READS = 64;
+
+static struct
+{
+	bool active;
+	bool reading;
+	u32 back_to_back_reads;
+	u32 cooldown_reads;
+	u32 last_read_end_cycle;
+	u32 last_read_end_sector[2];
+} s_fast_load;
+
+static void cdvdFastLoadStartRead(u32 sector, u32 count, bool audio)
+{
+	if (!EmuConfig.Speedhacks.fastLoad)
+		return;
+
+	// Streams top their buffers up every few frames, 10ms is well under that, and well over the time
+	// games spend between reads when they're just loading one file after another.
+	const u32 max_idle_cycles = static_cast<u32>(PSXCLK / 100);
+	const bool paced = !s_fast_load.reading && (psxRegs.cycle - s_fast_load.last_read_end_cycle) > max_idle_cycles;
+
+	// Picking up where the read before last left off means something else is being read in between.
+	const bool interleaved = (sector != s_fast_load.last_read_end_sector[0] && sector == s_fast_load.last_read_end_sector[1]);
+
+	if (audio || interleaved)
+	{
+		s_fast_load.back_to_back_reads = 0;
+		s_fast_load.cooldown_reads = FAST_LOAD_COOLDOWN_READS;
+	}
+	else if (paced)
+	{
+		s_fast_load.back_to_back_reads = 0;
+	}
+	else if (s_fast_load.cooldown_reads > 0)
+	{
+		s_fast_load.cooldown_reads--;
+	}
+	else if (s_fast_load.back_to_back_reads < FAST_LOAD_BACK_TO_BACK_READS)
+	{
+		s_fast_load.back_to_back_reads++;
+	}
+
+	const bool active = (s_fast_load.cooldown_reads == 0 && s_fast_load.back_to_back_reads >= FAST_LOAD_BACK_TO_BACK_READS);
+	if (active != s_fast_load.active)
+	{
+		CDVD_LOG("Fast loading %s at sector %u", active ? "enabled" : "disabled", sector);
+		s_fast_load.active = active;
+	}
+
+	s_fast_load.reading = true;
+	s_fast_load.last_read_end_sector[1] = s_fast_load.last_read_end_sector[0];
+	s_fast_load.last_read_end_sector[0] = sector + count;
+}
+
+static void cdvdFastLoadEndRead()
+{
+	s_fast_load.reading = false;
+	s_fast_load.last_read_end_cycle = psxRegs.cycle;
+}
+
+static __fi u32 cdvdFastLoadScale(u32 eCycle)
+{
+	if (s_fast_load.active && eCycle > 1)
+		eCycle = std::max<u32>(eCycle / FAST_LOAD_TIME_DIVISOR, 1);
+
+	return eCycle;
+}
+
 static void CDVDCancelReadAhead()
 {
 	cdvd.nextSectorsBuffered = 0;
@@ -68,6 +142,10 @@ static void CDVDSECTORREADY_INT(u32 eCycle)
 		if (eCycle < Cdvd_FullSeek_Cycles && eCycle > 1)
 			eCycle *= 0.5f;
 	}
+	else
+	{
+		eCycle = cdvdFastLoadScale(eCycle);
+	}
 
 	PSX_INT(IopEvt_CdvdSectorReady, eCycle);
 }
@@ -81,6 +159,10 @@ static void CDVDREAD_INT(u32 eCycle)
 		if (eCycle < Cdvd_FullSeek_Cycles && eCycle > 1)
 			eCycle *= 0.5f;
 	}
+	else
+	{
+		eCycle = cdvdFastLoadScale(eCycle);
+	}
 
 	PSX_INT(IopEvt_CdvdRead, eCycle);
 }
@@ -904,6 +986,7 @@ static uint cdvdBlockReadTime(CDVD_MODE_TYPE mode) noexcept
 void cdvdReset()
 {
 	std::memset(&cdvd, 0, sizeof(cdvd));
+	s_fast_load = {};
 
 	cdvd.DiscType = CDVD_TYPE_NODISC;
 	cdvd.Spinning = false;
@@ -960,6 +1043,7 @@ bool SaveStateBase::cdvdFreeze()
 		return false;
 
 	Freeze(cdvd);
+	Freeze(s_fast_load);
 	if (!IsOkay())
 		return false;
 
@@ -1321,6 +1405,7 @@ __fi void cdvdReadInterrupt()
 			// Setting the data ready flag fixes a black screen loading issue in
 			// Street Fighter Ex3 (NTSC-J version).
 			cdvdSetIrq();
+			cdvdFastLoadEndRead();
 			cdvdUpdateReady(CDVD_DRIVE_READY);
 			cdvd.Reading = 0;
 			if (cdvd.nextSectorsBuffered < 16)
@@ -1341,6 +1426,7 @@ __fi void cdvdReadInterrupt()
 		if (cdvd.SectorCnt <= 0)
 		{
 			cdvdSetIrq();
+			cdvdFastLoadEndRead();
 
 			cdvdUpdateReady(CDVD_DRIVE_READY);
 			cdvdUpdateStatus(CDVD_STATUS_PAUSE);
@@ -2014,6 +2100,7 @@ static void cdvdWrite04(u8 rt)
 				Console.WriteLn(Color_Gray, "CDRead: Reading Sector %07d (%03d Blocks of Size %d) at Speed=%dx(%s) Spindle=%x",
 					cdvd.SeekToSector, cdvd.SectorCnt, cdvd.BlockSize, cdvd.Speed, (cdvd.SpindlCtrl & CDVD_SPINDLE_CAV) ? "CAV" : "CLV", cdvd.SpindlCtrl);
 
+			cdvdFastLoadStartRead(cdvd.SeekToSector, cdvd.SectorCnt, false);
 			CDVDREAD_INT(cdvdStartSeek(cdvd.SeekToSector, static_cast<CDVD_MODE_TYPE>(cdvdIsDVD()), !(cdvd.SpindlCtrl & CDVD_SPINDLE_CAV) && (oldSpindleCtrl & CDVD_SPINDLE_CAV)));
 
 			// Read-ahead by telling CDVD about the track now.
@@ -2112,6 +2199,7 @@ static void cdvdWrite04(u8 rt)
 				Console.WriteLn(Color_Gray, "CdAudioRead: Reading Sector %07d (%03d Blocks of Size %d) at Speed=%dx(%s) Spindle=%x",
 					cdvd.CurrentSector, cdvd.SectorCnt, cdvd.BlockSize, cdvd.Speed, (cdvd.SpindlCtrl & CDVD_SPINDLE_CAV) ? "CAV" : "CLV", cdvd.SpindlCtrl);
 
+			cdvdFastLoadStartRead(cdvd.SeekToSector, cdvd.SectorCnt, true);
 			CDVDREAD_INT(cdvdStartSeek(cdvd.SeekToSector, MODE_CDROM, !(cdvd.SpindlCtrl& CDVD_SPINDLE_CAV) && (oldSpindleCtrl& CDVD_SPINDLE_CAV)));
 
 			// Read-ahead by telling CDVD about the track now.
@@ -2207,6 +2295,7 @@ static void cdvdWrite04(u8 rt)
 				Console.WriteLn(Color_Gray, "DvdRead: Reading Sector %07d (%03d Blocks of Size %d) at Speed=%dx(%s) SpindleCtrl=%x",
 					cdvd.SeekToSector, cdvd.SectorCnt, cdvd.BlockSize, cdvd.Speed, (cdvd.SpindlCtrl & CDVD_SPINDLE_CAV) ? "CAV" : "CLV", cdvd.SpindlCtrl);
 
+			cdvdFastLoadStartRead(cdvd.SeekToSector, cdvd.SectorCnt, false);
 			CDVDREAD_INT(cdvdStartSeek(cdvd.SeekToSector, MODE_DVDROM, !(cdvd.SpindlCtrl & CDVD_SPINDLE_CAV) && (oldSpindleCtrl& CDVD_SPINDLE_CAV)));
 
 			// Read-ahead by telling CDVD about the track now.
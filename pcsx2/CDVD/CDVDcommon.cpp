@@ -339,6 +339,9 @@ bool DoCDVDopen(Error* error)
 
 	int cdtype = DoCDVDdetectDiskType();
 
+	if (m_CurrentSourceType == CDVD_SourceType::Iso)
+		ISOloadFileExtents();
+
 	if (!EmuConfig.CdvdDumpBlocks || (cdtype == CDVD_TYPE_NODISC))
 	{
 		blockDumpFile.Close();
@@ -148,6 +148,9 @@ extern const CDVD_API CDVDapi_Iso;
 extern const CDVD_API CDVDapi_Disc;
 extern const CDVD_API CDVDapi_NoDisc;
 
+// Maps out the files on the open ISO image, so reads streaming through one of them can be read ahead.
+extern void ISOloadFileExtents();
+
 extern void CDVDsys_ChangeSource(CDVD_SourceType type);
 extern void CDVDsys_SetFile(CDVD_SourceType srctype, std::string newfile);
 extern const std::string& CDVDsys_GetFile(CDVD_SourceType srctype);
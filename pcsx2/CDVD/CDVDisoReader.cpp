@@ -8,6 +8,8 @@
 #include "common/Console.h"
 #include "common/Error.h"
 
+#include "fmt/format.h"
+
 #include <cstring>
 #include <array>
 
@@ -60,6 +62,24 @@ static bool ISOprecache(ProgressCallback* progress, Error* error)
 	return iso.Precache(progress, error);
 }
 
+void ISOloadFileExtents()
+{
+	if (!iso.IsOpened() || iso.GetType() == ISOTYPE_AUDIO)
+		return;
+
+	Error error;
+	IsoReader isor;
+	std::vector<IsoReader::FileExtent> extents;
+	if (!isor.Open(&error) || !isor.GetFileExtents(&extents, &error))
+	{
+		Console.Warning(fmt::format("ISO: Failed to map files for readahead: {}", error.GetDescription()));
+		return;
+	}
+
+	DevCon.WriteLn("ISO: Mapped %zu files for readahead", extents.size());
+	iso.SetFileExtents(std::move(extents));
+}
+
 static s32 ISOreadSubQ(u32 lsn, cdvdSubQ* subq)
 {
 	// fake it
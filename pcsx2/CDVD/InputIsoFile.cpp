@@ -18,6 +18,11 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+
+// How many sectors have to be read back to back before we assume the game is streaming the file.
+static constexpr u32 SEQUENTIAL_READS_FOR_READAHEAD = 16;
+
 static const char* nameFromType(int type)
 {
 	switch (type)
@@ -83,6 +88,7 @@ void InputIsoFile::BeginRead2(uint lsn)
 	if (lsn == m_read_lsn)
 		return;
 
+	UpdateReadahead(lsn);
 	m_read_lsn = lsn;
 
 	m_reader->BeginRead(m_readbuffer, m_read_lsn, 1);
@@ -163,6 +169,47 @@ int InputIsoFile::FinishRead3(u8* dst, uint mode)
 	return 0;
 }
 
+void InputIsoFile::SetFileExtents(std::vector<IsoReader::FileExtent> extents)
+{
+	m_file_extents = std::move(extents);
+}
+
+void InputIsoFile::UpdateReadahead(uint lsn)
+{
+	if (m_file_extents.empty())
+		return;
+
+	if (lsn != m_read_lsn + 1)
+	{
+		// Seeked away, so whatever we were streaming is probably done with.
+		m_sequential_reads = 0;
+		if (m_readahead_end != 0)
+		{
+			m_readahead_end = 0;
+			m_reader->SetReadaheadEnd(0);
+		}
+
+		return;
+	}
+
+	if (++m_sequential_reads < SEQUENTIAL_READS_FOR_READAHEAD || lsn < m_readahead_end)
+		return;
+
+	// Loading screens read whole files at a time, so keep reading ahead until the end of this one.
+	auto it = std::upper_bound(m_file_extents.begin(), m_file_extents.end(), lsn,
+		[](u32 lsn, const IsoReader::FileExtent& extent) { return lsn < extent.lsn; });
+	if (it == m_file_extents.begin())
+		return;
+
+	--it;
+	const u32 file_end = it->lsn + it->sector_count;
+	if (lsn >= file_end)
+		return;
+
+	m_readahead_end = file_end;
+	m_reader->SetReadaheadEnd(file_end);
+}
+
 InputIsoFile::InputIsoFile()
 {
 	_init();
@@ -186,6 +233,9 @@ void InputIsoFile::_init()
 	m_read_inprogress = false;
 	m_current_lsn = -1;
 	m_read_lsn = -1;
+	m_file_extents = {};
+	m_sequential_reads = 0;
+	m_readahead_end = 0;
 	m_reader.reset();
 }
 
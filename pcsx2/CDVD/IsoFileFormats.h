@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CDVD/CDVD.h"
+#include "CDVD/IsoReader.h"
 #include "CDVD/ThreadedFileReader.h"
 #include <memory>
 #include <string>
@@ -50,6 +51,11 @@ protected:
 	uint m_read_lsn;
 	u8 m_readbuffer[CD_FRAMESIZE_RAW];
 
+	// Where the files on the disc are, so sequential reads through one can be read ahead to its end.
+	std::vector<IsoReader::FileExtent> m_file_extents;
+	u32 m_sequential_reads;
+	u32 m_readahead_end;
+
 public:
 	InputIsoFile();
 	~InputIsoFile();
@@ -75,8 +81,11 @@ public:
 	void BeginRead2(uint lsn);
 	int FinishRead3(u8* dest, uint mode);
 
+	void SetFileExtents(std::vector<IsoReader::FileExtent> extents);
+
 protected:
 	void _init();
+	void UpdateReadahead(uint lsn);
 
 	bool tryIsoType(u32 size, u32 offset, u32 blockofs);
 	void FindParts();
@@ -11,7 +11,9 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <cctype>
+#include <unordered_set>
 
 IsoReader::IsoReader() = default;
 
@@ -306,3 +308,53 @@ bool IsoReader::ReadFile(const ISODirectoryEntry& de, std::vector<u8>* data, Err
 	data->resize(de.length_le);
 	return true;
 }
+
+bool IsoReader::GetFileExtents(std::vector<FileExtent>* extents, Error* error /*= nullptr*/)
+{
+	extents->clear();
+
+	const ISODirectoryEntry* root_de = reinterpret_cast<const ISODirectoryEntry*>(m_pvd.root_directory_entry);
+	std::vector<std::pair<u32, u32>> pending_directories;
+	pending_directories.emplace_back(root_de->location_le, root_de->length_le);
+
+	// Don't walk the same directory twice, in case a broken image links back up the tree.
+	std::unordered_set<u32> visited_directories;
+
+	u8 sector_buffer[SECTOR_SIZE];
+	while (!pending_directories.empty())
+	{
+		const auto [directory_record_lsn, directory_record_length] = pending_directories.back();
+		pending_directories.pop_back();
+		if (!visited_directories.insert(directory_record_lsn).second)
+			continue;
+
+		const u32 num_sectors = (directory_record_length + (SECTOR_SIZE - 1)) / SECTOR_SIZE;
+		for (u32 i = 0; i < num_sectors; i++)
+		{
+			if (!ReadSector(sector_buffer, directory_record_lsn + i, error))
+				return false;
+
+			u32 sector_offset = 0;
+			while ((sector_offset + sizeof(ISODirectoryEntry)) < SECTOR_SIZE)
+			{
+				const ISODirectoryEntry* de = reinterpret_cast<const ISODirectoryEntry*>(&sector_buffer[sector_offset]);
+				if (de->entry_length < sizeof(ISODirectoryEntry))
+					break;
+
+				const std::string_view de_filename = GetDirectoryEntryFileName(sector_buffer, sector_offset);
+				sector_offset += de->entry_length;
+
+				if (de_filename.empty() || de_filename == "." || de_filename == "..")
+					continue;
+
+				if (de->flags & ISODirectoryEntryFlag_Directory)
+					pending_directories.emplace_back(de->location_le, de->length_le);
+				else if (de->length_le > 0)
+					extents->push_back({de->location_le, (de->length_le + (SECTOR_SIZE - 1)) / SECTOR_SIZE});
+			}
+		}
+	}
+
+	std::sort(extents->begin(), extents->end(), [](const FileExtent& lhs, const FileExtent& rhs) { return lhs.lsn < rhs.lsn; });
+	return true;
+}
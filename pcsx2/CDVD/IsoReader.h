@@ -133,6 +133,12 @@ public:
 
 #pragma pack(pop)
 
+	struct FileExtent
+	{
+		u32 lsn;
+		u32 sector_count;
+	};
+
 	IsoReader();
 	~IsoReader();
 
@@ -153,6 +159,9 @@ public:
 	bool ReadFile(const std::string_view path, std::vector<u8>* data, Error* error = nullptr);
 	bool ReadFile(const ISODirectoryEntry& de, std::vector<u8>* data, Error* error = nullptr);
 
+	/// Walks the whole directory tree, and returns the sectors occupied by every file, sorted by LSN.
+	bool GetFileExtents(std::vector<FileExtent>* extents, Error* error = nullptr);
+
 private:
 	static std::string_view GetDirectoryEntryFileName(const u8* sector, u32 de_sector_offset);
 
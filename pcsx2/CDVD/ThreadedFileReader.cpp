@@ -16,6 +16,8 @@
 // Make sure buffer size is bigger than the cutoff where PCSX2 emulates a seek
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
+// How far a buffer can grow when streaming through a file, there's two of them
+static constexpr u32 MAXIMUM_STREAMING_SIZE = 8 * 1024 * 1024;
 
 ThreadedFileReader::ThreadedFileReader()
 {
@@ -111,7 +113,7 @@ void ThreadedFileReader::Loop()
 					chunk = ChunkForOffset(buf->offset + bufsize);
 					if (chunk.chunkID < 0)
 						break;
-					if (buf->offset + bufsize != chunk.offset || chunk.length + bufsize > buf->cap)
+					if (buf->offset + bufsize != chunk.offset || (chunk.length + bufsize > buf->cap && !TryGrowBuffer(buf, chunk.length)))
 					{
 						buffersFilled++;
 						if (buffersFilled >= 2)
@@ -181,6 +183,24 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 	return nullptr;
 }
 
+bool ThreadedFileReader::TryGrowBuffer(Buffer* buf, u32 size)
+{
+	const u32 bufsize = buf->size.load(std::memory_order_relaxed);
+	if (buf->offset + bufsize >= m_readaheadEnd.load(std::memory_order_relaxed) || bufsize + size > MAXIMUM_STREAMING_SIZE)
+		return false;
+
+	// Readers copy out of the buffers with the lock held, so it can't move under them
+	std::lock_guard<std::mutex> lock(m_mtx);
+	const u32 cap = std::min(std::max(buf->cap * 2, bufsize + size), MAXIMUM_STREAMING_SIZE);
+	void* ptr = realloc(buf->ptr, cap);
+	if (!ptr)
+		return false;
+
+	buf->ptr = ptr;
+	buf->cap = cap;
+	return true;
+}
+
 bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 {
 	char* write = static_cast<char*>(target);
@@ -393,6 +413,7 @@ void ThreadedFileReader::Close(void)
 	CancelAndWaitUntilStopped();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
+	m_readaheadEnd.store(0, std::memory_order_relaxed);
 	Close2();
 }
 
@@ -405,3 +426,9 @@ void ThreadedFileReader::SetDataOffset(u32 bytes)
 {
 	m_dataoffset = bytes;
 }
+
+void ThreadedFileReader::SetReadaheadEnd(u32 sector)
+{
+	const u64 offset = sector ? static_cast<u64>(sector) * InternalBlockSize() + m_dataoffset : 0;
+	m_readaheadEnd.store(offset, std::memory_order_relaxed);
+}
@@ -74,6 +74,8 @@ private:
 	};
 	/// 2 buffers for readahead (current block, next block)
 	Buffer m_buffer[2];
+	/// Offset (in internal block bytes) up to which readahead may grow the buffers past `MINIMUM_SIZE`, 0 if there's nothing to stream
+	std::atomic<u64> m_readaheadEnd{0};
 	u32 m_nextBuffer = 0;
 
 	std::thread m_readThread;
@@ -97,6 +99,9 @@ private:
 
 	/// Load the given block into one of the `m_buffer` buffers if necessary and return a pointer to its contents if successful
 	Buffer* GetBlockPtr(const Chunk& block);
+	/// Grow `buf` so `size` more bytes can be appended to it, if it's being streamed into and isn't too big already
+	/// Only call from the read thread
+	bool TryGrowBuffer(Buffer* buf, u32 size);
 	/// Decompress from offset to size into
 	bool Decompress(void* ptr, u64 offset, u32 size);
 	/// Cancel any inflight read and wait until the thread is no longer doing anything
@@ -124,4 +129,7 @@ public:
 	void Close();
 	void SetBlockSize(u32 bytes);
 	void SetDataOffset(u32 bytes);
+	/// Lets readahead keep going until the given sector, instead of stopping after a couple of buffers
+	/// Use when the caller knows it's about to stream a large run of sectors, 0 to go back to the default
+	void SetReadaheadEnd(u32 sector);
 };
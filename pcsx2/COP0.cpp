@@ -32,6 +32,9 @@ void WriteCP0Config(u32 value)
 	// Protect the read-only ICacheSize (IC) and DataCacheSize (DC) bits
 	cpuRegs.CP0.n.Config = value & ~0xFC0;
 	cpuRegs.CP0.n.Config |= 0x440;
+
+	// Bit 16 (DCE) enables the data cache.
+	vtlb_UpdateCacheMap();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +345,7 @@ void WriteTLB(int i)
 	tlb[i].S = cpuRegs.CP0.n.EntryLo0 & 0x80000000;
 
 	MapTLB(tlb[i], i);
+	vtlb_UpdateCacheMap();
 }
 
 namespace R5900 {
@@ -5,6 +5,8 @@
 #include "Cache.h"
 #include "vtlb.h"
 
+#include "fmt/format.h"
+
 using namespace R5900;
 using namespace vtlb_private;
 
@@ -102,6 +104,7 @@ namespace
 
 			uptr target = addr();
 
+			g_cacheStats.writebacks++;
 			CACHE_LOG("Write back at %zx", target);
 			if (tag.validPFN)
 				*reinterpret_cast<CacheData*>(target) = data;
@@ -155,12 +158,34 @@ namespace
 		}
 	};
 
+	static_assert(sizeof(CacheSet) == CACHE_SET_SIZE && offsetof(CacheSet, tags) == CACHE_TAG_OFFSET &&
+				  sizeof(CacheTag) == CACHE_TAG_SIZE && offsetof(CacheSet, data) == CACHE_DATA_OFFSET &&
+				  sizeof(CacheData) == CACHE_LINE_SIZE && sizeof(Cache::sets) / sizeof(CacheSet) == CACHE_NUM_SETS,
+		"Cache layout doesn't match what the recompiler expects");
+	static_assert(CacheTag::DIRTY_FLAG == CACHE_TAG_DIRTY && CacheTag::VALID_FLAG == CACHE_TAG_VALID &&
+				  CacheTag::LOCK_FLAG == CACHE_TAG_LOCK);
+
 	static Cache cache = {};
 } // namespace
 
+CacheStats g_cacheStats = {};
+
+void* getCacheSets()
+{
+	return cache.sets;
+}
+
 void resetCache()
 {
+	const CacheStats& stats = g_cacheStats;
+	if (stats.inline_hits != 0 || stats.slow_hits != 0 || stats.fills != 0)
+	{
+		DevCon.WriteLn(fmt::format("EE cache: {} inline hits, {} slow hits, {} fills, {} writebacks", stats.inline_hits,
+			stats.slow_hits, stats.fills, stats.writebacks));
+	}
+
 	std::memset(&cache, 0, sizeof(cache));
+	g_cacheStats = {};
 }
 
 static bool findInCache(const CacheSet& set, uptr ppf, int* way)
@@ -194,6 +219,8 @@ static int getFreeCache(u32 mem, int* way, bool validPFN)
 
 	if (findInCache(set, ppf, way))
 	{
+		g_cacheStats.slow_hits++;
+
 		[[unlikely]]
 		if (set.tags[*way].isLocked())
 		{
@@ -224,6 +251,7 @@ static int getFreeCache(u32 mem, int* way, bool validPFN)
 			}
 		}
 		*way = newWay;
+		g_cacheStats.fills++;
 
 		CacheLine line = cache.lineAt(setIdx, newWay);
 		line.writeBackIfNeeded();
@@ -7,6 +7,29 @@
 
 #include "common/SingleRegisterTypes.h"
 
+// Layout of the data cache, which the recompiler relies on to check tags and access lines inline.
+// Each set holds both tags (padded out to a line), followed by the data for both ways.
+static constexpr u32 CACHE_NUM_SETS = 64;
+static constexpr u32 CACHE_LINE_SIZE = 64;
+static constexpr u32 CACHE_SET_SIZE = 192;
+static constexpr u32 CACHE_TAG_OFFSET = 0;
+static constexpr u32 CACHE_TAG_SIZE = 16;
+static constexpr u32 CACHE_DATA_OFFSET = 64;
+static constexpr u32 CACHE_TAG_DIRTY = 0x40;
+static constexpr u32 CACHE_TAG_VALID = 0x20;
+static constexpr u32 CACHE_TAG_LOCK = 0x8;
+
+struct CacheStats
+{
+	u64 inline_hits; // Hits handled by recompiled code.
+	u64 slow_hits;
+	u64 fills;
+	u64 writebacks;
+};
+
+extern CacheStats g_cacheStats;
+
+void* getCacheSets();
 void resetCache();
 void writeCache8(u32 mem, u8 value, bool validPFN = true);
 void writeCache16(u32 mem, u16 value, bool validPFN = true);
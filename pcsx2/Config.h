@@ -187,6 +187,7 @@ enum class SpeedHack
 	InstantVU1,
 	MTVU,
 	EECycleRate,
+	FastLoad,
 	MaxCount,
 };
 
@@ -525,10 +526,14 @@ struct Pcsx2Config
 
 		bool
 			EnableEECache : 1;
+		bool
+			EnableEECachedInterpreter : 1;
 		bool
 			EnableFastmem : 1;
 		bool
 			PauseOnTLBMiss : 1;
+		bool
+			EnableAnalysisCache : 1;
 		BITFIELD_END
 
 		RecompilerOptions();
@@ -593,6 +598,12 @@ struct Pcsx2Config
 		static constexpr int DEFAULT_VIDEO_CAPTURE_WIDTH = 640;
 		static constexpr int DEFAULT_VIDEO_CAPTURE_HEIGHT = 480;
 		static constexpr int DEFAULT_AUDIO_CAPTURE_BITRATE = 192;
+
+		// MTGS/MTVU command ring sizes, in megabytes. Must be powers of two.
+		static constexpr u32 MIN_RING_SIZE = 2;
+		static constexpr u32 MAX_RING_SIZE = 64;
+		static constexpr u32 DEFAULT_MTGS_RING_SIZE = 8;
+		static constexpr u32 DEFAULT_MTVU_RING_SIZE = 16;
 		static const char* DEFAULT_CAPTURE_CONTAINER;
 
 		union
@@ -676,6 +687,10 @@ struct Pcsx2Config
 
 		int VsyncQueueSize = 2;
 
+		// Sizes of the MTGS and MTVU command rings, picked up when the VM starts.
+		u32 MTGSRingSize = DEFAULT_MTGS_RING_SIZE;
+		u32 MTVURingSize = DEFAULT_MTVU_RING_SIZE;
+
 		float FramerateNTSC = DEFAULT_FRAME_RATE_NTSC;
 		float FrameratePAL = DEFAULT_FRAME_RATE_PAL;
 
@@ -809,10 +824,13 @@ struct Pcsx2Config
 			AccessLog : 1,
 			DMALog : 1,
 			WaveLog : 1,
+			WaveLogVoices : 1,
 			CoresDump : 1,
 			MemDump : 1,
 			RegDump : 1,
-			VisualDebugEnabled : 1;
+			VisualDebugEnabled : 1,
+			BlockMixing : 1,
+			ThreadedMixing : 1;
 		BITFIELD_END
 
 		u32 OutputVolume = 100;
@@ -955,7 +973,10 @@ struct Pcsx2Config
 			WaitLoop : 1, // enables constant loop detection and fast-forwarding
 			vuFlagHack : 1, // microVU specific flag hack
 			vuThread : 1, // Enable Threaded VU1
-			vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+			vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+			iopThread : 1, // Run the IOP on its own thread
+			ipuThread : 1, // Run IPU commands on their own thread
+			fastLoad : 1; // shortens CDVD seeks and reads while the game appears to be loading
 		BITFIELD_END
 
 		s8 EECycleRate; // EE cycle rate selector (1.0, 1.5, 2.0)
@@ -1268,6 +1289,8 @@ namespace EmuFolders
 #define THREAD_VU1 false
 #endif
 #define INSTANT_VU1 (EmuConfig.Speedhacks.vu1Instant)
+#define THREAD_IOP (EmuConfig.Speedhacks.iopThread)
+#define THREAD_IPU (EmuConfig.Speedhacks.ipuThread)
 #define CHECK_EEREC (EmuConfig.Cpu.Recompiler.EnableEE)
 #define CHECK_CACHE (EmuConfig.Cpu.Recompiler.EnableEECache)
 #define CHECK_IOPREC (EmuConfig.Cpu.Recompiler.EnableIOP)
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <array>
+#include <utility>
+
+// CycleEventQueue - Binary min-heap of pending events, ordered by the absolute cycle they are
+// due on, so the next event is always at the top. Each event id has at most one entry, and its
+// position in the heap is tracked so rescheduling or cancelling is O(log n).
+//
+// The owning CPU's interrupt bitmask stays the authoritative record of which events are pending
+// (it's what gets saved in states, and plenty of code clears bits directly), so entries whose bit
+// has been cleared are simply dropped when they reach the top (see Prune).
+//
+// Cycle counters wrap, so deadlines are compared by signed difference like everywhere else.
+template <u32 MaxEvents>
+class CycleEventQueue
+{
+	static_assert(MaxEvents <= 32, "Pending mask is 32 bits");
+
+public:
+	void Clear()
+	{
+		m_size = 0;
+		m_pos.fill(NOT_QUEUED);
+	}
+
+	/// Adds the event, or moves it if it's already queued.
+	void Schedule(u32 id, u32 deadline)
+	{
+		m_deadline[id] = deadline;
+
+		u32 pos = m_pos[id];
+		if (pos == NOT_QUEUED)
+		{
+			pos = m_size++;
+			m_heap[pos] = static_cast<u8>(id);
+			m_pos[id] = static_cast<u8>(pos);
+		}
+
+		SiftDown(SiftUp(pos));
+	}
+
+	void Cancel(u32 id)
+	{
+		const u32 pos = m_pos[id];
+		if (pos == NOT_QUEUED)
+			return;
+
+		RemoveAt(pos);
+	}
+
+	/// Drops events from the top of the queue which are no longer pending.
+	__fi void Prune(u32 pending_mask)
+	{
+		while (m_size > 0 && !(pending_mask & (1u << m_heap[0])))
+			RemoveAt(0);
+	}
+
+	__fi bool IsEmpty() const { return (m_size == 0); }
+
+	/// Returns the cycle the earliest event is due on. The queue must not be empty.
+	__fi u32 GetNextDeadline() const { return m_deadline[m_heap[0]]; }
+
+	/// Returns true if the earliest event is due at the specified cycle.
+	__fi bool IsDue(u32 cycle) const { return (m_size > 0 && static_cast<s32>(cycle - GetNextDeadline()) >= 0); }
+
+private:
+	static constexpr u8 NOT_QUEUED = 0xFF;
+
+	__fi bool Before(u32 lhs_pos, u32 rhs_pos) const
+	{
+		return static_cast<s32>(m_deadline[m_heap[lhs_pos]] - m_deadline[m_heap[rhs_pos]]) < 0;
+	}
+
+	__fi void Swap(u32 a, u32 b)
+	{
+		std::swap(m_heap[a], m_heap[b]);
+		m_pos[m_heap[a]] = static_cast<u8>(a);
+		m_pos[m_heap[b]] = static_cast<u8>(b);
+	}
+
+	u32 SiftUp(u32 pos)
+	{
+		while (pos > 0)
+		{
+			const u32 parent = (pos - 1) / 2;
+			if (!Before(pos, parent))
+				break;
+
+			Swap(pos, parent);
+			pos = parent;
+		}
+
+		return pos;
+	}
+
+	void SiftDown(u32 pos)
+	{
+		for (;;)
+		{
+			const u32 left = pos * 2 + 1;
+			const u32 right = left + 1;
+			u32 smallest = pos;
+			if (left < m_size && Before(left, smallest))
+				smallest = left;
+			if (right < m_size && Before(right, smallest))
+				smallest = right;
+			if (smallest == pos)
+				break;
+
+			Swap(pos, smallest);
+			pos = smallest;
+		}
+	}
+
+	void RemoveAt(u32 pos)
+	{
+		m_pos[m_heap[pos]] = NOT_QUEUED;
+
+		const u32 last = --m_size;
+		if (pos == last)
+			return;
+
+		m_heap[pos] = m_heap[last];
+		m_pos[m_heap[pos]] = static_cast<u8>(pos);
+		SiftDown(SiftUp(pos));
+	}
+
+	std::array<u8, MaxEvents> m_heap = {};
+	std::array<u8, MaxEvents> m_pos = MakeEmptyPositions();
+	std::array<u32, MaxEvents> m_deadline = {};
+	u32 m_size = 0;
+
+	static constexpr std::array<u8, MaxEvents> MakeEmptyPositions()
+	{
+		std::array<u8, MaxEvents> ret = {};
+		for (u8& pos : ret)
+			pos = NOT_QUEUED;
+		return ret;
+	}
+};
@@ -0,0 +1,289 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "GuestProfiler.h"
+#include "SymbolGuardian.h"
+
+#include "Config.h"
+#include "Host.h"
+#include "IconsFontAwesome5.h"
+#include "VMManager.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace GuestProfiler
+{
+	struct BlockStats
+	{
+		u64 cycles = 0;
+		u64 samples = 0;
+	};
+
+	struct SourceState
+	{
+		std::unordered_map<u32, BlockStats> blocks;
+		u32 last_pc = 0;
+		u32 last_cycle = 0;
+		bool has_last_cycle = false;
+	};
+
+	struct ReportEntry
+	{
+		u32 pc;
+		u64 cycles;
+		u64 samples;
+		std::string function;
+	};
+
+	static constexpr std::array<const char*, static_cast<size_t>(Source::Count)> s_source_names = {{"EE", "IOP", "VU0", "VU1"}};
+
+	static const char* GetSourceName(Source source);
+	static std::vector<ReportEntry> BuildReport(Source source);
+	static std::string GetReportBasePath();
+
+	// VU1 samples can come from the MTVU thread, and IOP samples from the IOP thread.
+	static std::mutex s_mutex;
+	static std::array<SourceState, static_cast<size_t>(Source::Count)> s_sources;
+} // namespace GuestProfiler
+
+std::atomic_bool GuestProfiler::Internal::s_active{false};
+
+const char* GuestProfiler::GetSourceName(Source source)
+{
+	return s_source_names[static_cast<size_t>(source)];
+}
+
+void GuestProfiler::Start()
+{
+	std::unique_lock lock(s_mutex);
+	for (SourceState& state : s_sources)
+		state = {};
+
+	Internal::s_active.store(true, std::memory_order_release);
+	Console.WriteLn("(GuestProfiler) Started collecting samples.");
+}
+
+std::string GuestProfiler::Stop()
+{
+	if (!Internal::s_active.exchange(false, std::memory_order_acq_rel))
+		return {};
+
+	bool has_samples = false;
+	{
+		std::unique_lock lock(s_mutex);
+		for (const SourceState& state : s_sources)
+			has_samples |= !state.blocks.empty();
+	}
+	if (!has_samples)
+	{
+		Console.Warning("(GuestProfiler) Stopped without collecting any samples.");
+		return {};
+	}
+
+	const std::string base_path = GetReportBasePath();
+	Error error;
+	if (!ExportFoldedStacks(base_path + ".folded", &error) || !ExportJSON(base_path + ".json", &error))
+	{
+		Console.Error(fmt::format("(GuestProfiler) Failed to write report: {}", error.GetDescription()));
+		return {};
+	}
+
+	Console.WriteLn(fmt::format("(GuestProfiler) Wrote report to {}.{{folded,json}}", base_path));
+	return base_path;
+}
+
+void GuestProfiler::Toggle()
+{
+	if (!IsActive())
+	{
+		Start();
+		Host::AddIconOSDMessage("GuestProfiler", ICON_FA_STOPWATCH, TRANSLATE_STR("GuestProfiler", "Guest profiler started."),
+			Host::OSD_QUICK_DURATION);
+		return;
+	}
+
+	const std::string path = Stop();
+	if (path.empty())
+	{
+		Host::AddIconOSDMessage("GuestProfiler", ICON_FA_STOPWATCH,
+			TRANSLATE_STR("GuestProfiler", "Guest profiler stopped, no report was written."), Host::OSD_INFO_DURATION);
+	}
+	else
+	{
+		Host::AddIconOSDMessage("GuestProfiler", ICON_FA_STOPWATCH,
+			fmt::format(TRANSLATE_FS("GuestProfiler", "Guest profile saved to '{}'."), Path::GetFileName(path)),
+			Host::OSD_INFO_DURATION);
+	}
+}
+
+void GuestProfiler::Sample(Source source, u32 pc, u32 cycle)
+{
+	std::unique_lock lock(s_mutex);
+	SourceState& state = s_sources[static_cast<size_t>(source)];
+	if (state.has_last_cycle)
+	{
+		BlockStats& stats = state.blocks[state.last_pc];
+		stats.cycles += cycle - state.last_cycle;
+		stats.samples++;
+	}
+
+	state.last_pc = pc;
+	state.last_cycle = cycle;
+	state.has_last_cycle = true;
+}
+
+void GuestProfiler::Record(Source source, u32 pc, u32 cycles)
+{
+	std::unique_lock lock(s_mutex);
+	BlockStats& stats = s_sources[static_cast<size_t>(source)].blocks[pc];
+	stats.cycles += cycles;
+	stats.samples++;
+}
+
+std::vector<GuestProfiler::ReportEntry> GuestProfiler::BuildReport(Source source)
+{
+	std::vector<ReportEntry> entries;
+	{
+		std::unique_lock lock(s_mutex);
+		const SourceState& state = s_sources[static_cast<size_t>(source)];
+		entries.reserve(state.blocks.size());
+		for (const auto& [pc, stats] : state.blocks)
+			entries.push_back({pc, stats.cycles, stats.samples, std::string()});
+	}
+
+	// Only the EE and IOP have symbol tables, microprograms are identified by their start address.
+	const SymbolGuardian* guardian = (source == Source::EE) ? &R5900SymbolGuardian :
+	                                 (source == Source::IOP) ? &R3000SymbolGuardian : nullptr;
+	for (ReportEntry& entry : entries)
+	{
+		if (guardian)
+			entry.function = guardian->FunctionOverlappingAddress(entry.pc).name;
+		if (entry.function.empty())
+			entry.function = "[unknown]";
+	}
+
+	std::sort(entries.begin(), entries.end(), [](const ReportEntry& lhs, const ReportEntry& rhs) {
+		return (lhs.cycles != rhs.cycles) ? (lhs.cycles > rhs.cycles) : (lhs.pc < rhs.pc);
+	});
+	return entries;
+}
+
+std::string GuestProfiler::GetReportBasePath()
+{
+	std::string serial = VMManager::GetDiscSerial();
+	if (serial.empty())
+		serial = "unknown";
+	Path::SanitizeFileName(&serial);
+
+	char local_time[16] = {};
+	const time_t cur_time = time(nullptr);
+	strftime(local_time, sizeof(local_time), "%Y%m%d%H%M%S", localtime(&cur_time));
+
+	return Path::Combine(EmuFolders::Logs, fmt::format("profile_{}_{}", serial, local_time));
+}
+
+bool GuestProfiler::ExportFoldedStacks(const std::string& path, Error* error)
+{
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	for (u32 i = 0; i < static_cast<u32>(Source::Count); i++)
+	{
+		const Source source = static_cast<Source>(i);
+		for (const ReportEntry& entry : BuildReport(source))
+		{
+			// Semicolons separate frames, so they can't appear in (demangled) names.
+			std::string function = entry.function;
+			std::replace(function.begin(), function.end(), ';', ':');
+			std::fprintf(fp.get(), "%s;%s;%08X %" PRIu64 "\n", GetSourceName(source), function.c_str(), entry.pc, entry.cycles);
+		}
+	}
+
+	if (std::ferror(fp.get()))
+	{
+		Error::SetStringView(error, "Failed to write folded stack report.");
+		return false;
+	}
+
+	return true;
+}
+
+bool GuestProfiler::ExportJSON(const std::string& path, Error* error)
+{
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	const auto escape = [](std::string_view str) {
+		std::string ret;
+		ret.reserve(str.size());
+		for (const char ch : str)
+		{
+			if (ch == '"' || ch == '\\')
+				ret.push_back('\\');
+			if (static_cast<unsigned char>(ch) < 0x20)
+				ret.append(fmt::format("\\u{:04x}", static_cast<unsigned char>(ch)));
+			else
+				ret.push_back(ch);
+		}
+		return ret;
+	};
+
+	std::fprintf(fp.get(), "{\n  \"serial\": \"%s\",\n  \"cpus\": [", escape(VMManager::GetDiscSerial()).c_str());
+	for (u32 i = 0; i < static_cast<u32>(Source::Count); i++)
+	{
+		const Source source = static_cast<Source>(i);
+		const std::vector<ReportEntry> entries = BuildReport(source);
+
+		u64 total_cycles = 0;
+		std::unordered_map<std::string_view, u64> function_cycles;
+		for (const ReportEntry& entry : entries)
+		{
+			total_cycles += entry.cycles;
+			function_cycles[entry.function] += entry.cycles;
+		}
+
+		std::vector<std::pair<std::string_view, u64>> functions(function_cycles.begin(), function_cycles.end());
+		std::sort(functions.begin(), functions.end(), [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+		std::fprintf(fp.get(), "%s\n    {\n      \"name\": \"%s\",\n      \"total_cycles\": %" PRIu64 ",\n      \"functions\": [",
+			(i == 0) ? "" : ",", GetSourceName(source), total_cycles);
+		for (size_t j = 0; j < functions.size(); j++)
+		{
+			std::fprintf(fp.get(), "%s\n        {\"name\": \"%s\", \"cycles\": %" PRIu64 "}", (j == 0) ? "" : ",",
+				escape(functions[j].first).c_str(), functions[j].second);
+		}
+		std::fprintf(fp.get(), "\n      ],\n      \"blocks\": [");
+		for (size_t j = 0; j < entries.size(); j++)
+		{
+			const ReportEntry& entry = entries[j];
+			std::fprintf(fp.get(),
+				"%s\n        {\"pc\": \"0x%08X\", \"function\": \"%s\", \"cycles\": %" PRIu64 ", \"samples\": %" PRIu64 "}",
+				(j == 0) ? "" : ",", entry.pc, escape(entry.function).c_str(), entry.cycles, entry.samples);
+		}
+		std::fprintf(fp.get(), "\n      ]\n    }");
+	}
+	std::fprintf(fp.get(), "\n  ]\n}\n");
+
+	if (std::ferror(fp.get()))
+	{
+		Error::SetStringView(error, "Failed to write JSON report.");
+		return false;
+	}
+
+	return true;
+}
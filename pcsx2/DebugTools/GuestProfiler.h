@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <atomic>
+#include <string>
+
+class Error;
+
+// Runtime-togglable guest profiler. Each CPU reports where it is at its natural sync points (event tests for
+// the EE, each IOP/VU time slice), along with how many guest cycles were spent from there. Those cycles are
+// attributed to the PC execution started from, and on export resolved to guest function names through the
+// symbol database, so a report can be produced from any build without recompiling.
+namespace GuestProfiler
+{
+	enum class Source : u8
+	{
+		EE,
+		IOP,
+		VU0,
+		VU1,
+		Count
+	};
+
+	namespace Internal
+	{
+		extern std::atomic_bool s_active;
+	} // namespace Internal
+
+	/// Returns true if samples are currently being collected. Cheap enough to check on the hot path.
+	__fi bool IsActive() { return Internal::s_active.load(std::memory_order_relaxed); }
+
+	/// Clears any previous samples and starts collecting. Must be called on the CPU thread.
+	void Start();
+
+	/// Stops collecting and writes the folded stack and JSON reports to the logs directory.
+	/// Returns the base path of the reports, or an empty string if nothing was collected.
+	std::string Stop();
+
+	/// Starts or stops the profiler, notifying the user through the OSD.
+	void Toggle();
+
+	/// Attributes the cycles elapsed since the previous sample of this source to the PC it was taken at,
+	/// then records the specified PC as where execution resumes from.
+	void Sample(Source source, u32 pc, u32 cycle);
+
+	/// Attributes an explicit number of cycles to the specified PC.
+	void Record(Source source, u32 pc, u32 cycles);
+
+	/// Writes a flamegraph-compatible folded stack report (cpu;function;block cycles).
+	bool ExportFoldedStacks(const std::string& path, Error* error);
+
+	/// Writes a JSON report with per-block and per-function totals for each CPU.
+	bool ExportJSON(const std::string& path, Error* error);
+} // namespace GuestProfiler
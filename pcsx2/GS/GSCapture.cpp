@@ -136,7 +136,8 @@ extern "C" {
 namespace GSCapture
 {
 	static constexpr u32 NUM_FRAMES_IN_FLIGHT = 3;
-	static constexpr u32 MAX_PENDING_FRAMES = NUM_FRAMES_IN_FLIGHT * 2;
+	static constexpr u32 NUM_CONVERT_THREADS = 2;
+	static constexpr u32 MAX_PENDING_FRAMES = NUM_FRAMES_IN_FLIGHT * 2 + NUM_CONVERT_THREADS;
 	static constexpr u32 AUDIO_BUFFER_SIZE = Common::AlignUpPow2((MAX_PENDING_FRAMES * 48000) / 60, AudioStream::CHUNK_SIZE);
 	static constexpr u32 AUDIO_CHANNELS = 2;
 
@@ -146,6 +147,8 @@ namespace GSCapture
 		{
 			Unused,
 			NeedsMap,
+			NeedsConversion,
+			Converting,
 			NeedsEncoding
 		};
 
@@ -161,10 +164,12 @@ namespace GSCapture
 	static bool IsUsingHardwareVideoEncoding();
 	static void ProcessFramePendingMap(std::unique_lock<std::mutex>& lock);
 	static void ProcessAllInFlightFrames(std::unique_lock<std::mutex>& lock);
+	static void ConvertThreadEntryPoint(u32 index);
 	static void EncoderThreadEntryPoint();
 	static void StartEncoderThread();
 	static void StopEncoderThread(std::unique_lock<std::mutex>& lock);
-	static bool SendFrame(const PendingFrame& pf);
+	static bool ConvertFrame(const PendingFrame& pf, AVFrame* frame, SwsContext** sws_context);
+	static bool SendFrame(const PendingFrame& pf, AVFrame* frame);
 	static bool ReceivePackets(AVCodecContext* codec_context, AVStream* stream, AVPacket* packet);
 	static bool ProcessAudioPackets(s64 video_pts);
 	static void InternalEndCapture(std::unique_lock<std::mutex>& lock);
@@ -180,10 +185,10 @@ namespace GSCapture
 
 	static AVCodecContext* s_video_codec_context = nullptr;
 	static AVStream* s_video_stream = nullptr;
-	static AVFrame* s_converted_video_frame = nullptr; // YUV
+	static std::array<AVFrame*, MAX_PENDING_FRAMES> s_converted_video_frames = {}; // YUV, one per pending frame
 	static AVFrame* s_hw_video_frame = nullptr;
 	static AVPacket* s_video_packet = nullptr;
-	static SwsContext* s_sws_context = nullptr;
+	static std::array<SwsContext*, NUM_CONVERT_THREADS> s_sws_contexts = {}; // one per convert thread
 	static AVDictionary* s_video_codec_arguments = nullptr;
 	static AVBufferRef* s_video_hw_context = nullptr;
 	static AVBufferRef* s_video_hw_frames = nullptr;
@@ -201,15 +206,21 @@ namespace GSCapture
 	static u32 s_audio_frame_pos = 0;
 	static bool s_audio_frame_planar = false;
 
+	// Frames go through the pending frame queue in order: the GS thread downloads and maps them, the convert threads
+	// turn them into the encoder's pixel format (several frames at once), and the encoder thread encodes them in order.
 	static Threading::Thread s_encoder_thread;
+	static std::array<Threading::Thread, NUM_CONVERT_THREADS> s_convert_threads;
+	static std::condition_variable s_frame_convert_cv;
 	static std::condition_variable s_frame_ready_cv;
 	static std::condition_variable s_frame_encoded_cv;
 	static std::array<PendingFrame, MAX_PENDING_FRAMES> s_pending_frames = {};
 	static u32 s_pending_frames_pos = 0;
 	static u32 s_frames_pending_map = 0;
 	static u32 s_frames_map_consume_pos = 0;
+	static u32 s_frames_convert_consume_pos = 0;
 	static u32 s_frames_pending_encode = 0;
 	static u32 s_frames_encode_consume_pos = 0;
+	static std::atomic<u32> s_dropped_frames{0};
 
 	// NOTE: So this doesn't need locking, we allocate it once, and leave it.
 	static std::unique_ptr<s16[]> s_audio_buffer;
@@ -555,6 +566,10 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 
 		bool has_pixel_format_override = wrap_av_dict_get(s_video_codec_arguments, "pixel_format", nullptr, 0);
 
+		// Software encoders only use one thread unless told otherwise, let them pick. The "threads" parameter still overrides this.
+		s_video_codec_context->thread_count = 0;
+		s_video_codec_context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
 		res = wrap_avcodec_open2(s_video_codec_context, vcodec, &s_video_codec_arguments);
 		if (res < 0)
 		{
@@ -567,22 +582,32 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 		if (has_pixel_format_override)
 			sw_pix_fmt = s_video_codec_context->pix_fmt;
 
-		s_converted_video_frame = wrap_av_frame_alloc();
-		s_hw_video_frame = IsUsingHardwareVideoEncoding() ? wrap_av_frame_alloc() : nullptr;
-		if (!s_converted_video_frame || (IsUsingHardwareVideoEncoding() && !s_hw_video_frame))
+		for (AVFrame*& frame : s_converted_video_frames)
 		{
-			LogAVError(AVERROR(ENOMEM), "Failed to allocate frame: ");
-			InternalEndCapture(lock);
-			return false;
+			frame = wrap_av_frame_alloc();
+			if (!frame)
+			{
+				LogAVError(AVERROR(ENOMEM), "Failed to allocate frame: ");
+				InternalEndCapture(lock);
+				return false;
+			}
+
+			frame->format = sw_pix_fmt;
+			frame->width = s_video_codec_context->width;
+			frame->height = s_video_codec_context->height;
+			res = wrap_av_frame_get_buffer(frame, 0);
+			if (res < 0)
+			{
+				LogAVError(res, "av_frame_get_buffer() for converted frame failed: ");
+				InternalEndCapture(lock);
+				return false;
+			}
 		}
 
-		s_converted_video_frame->format = sw_pix_fmt;
-		s_converted_video_frame->width = s_video_codec_context->width;
-		s_converted_video_frame->height = s_video_codec_context->height;
-		res = wrap_av_frame_get_buffer(s_converted_video_frame, 0);
-		if (res < 0)
+		s_hw_video_frame = IsUsingHardwareVideoEncoding() ? wrap_av_frame_alloc() : nullptr;
+		if (IsUsingHardwareVideoEncoding() && !s_hw_video_frame)
 		{
-			LogAVError(res, "av_frame_get_buffer() for converted frame failed: ");
+			LogAVError(AVERROR(ENOMEM), "Failed to allocate frame: ");
 			InternalEndCapture(lock);
 			return false;
 		}
@@ -629,6 +654,7 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 		}
 
 		s_next_video_pts = 0;
+		s_dropped_frames.store(0, std::memory_order_relaxed);
 	}
 
 	if (capture_audio)
@@ -863,11 +889,14 @@ bool GSCapture::DeliverVideoFrame(GSTexture* stex)
 
 	PendingFrame& pf = s_pending_frames[s_pending_frames_pos];
 
-	// It shouldn't be pending map, but the encode thread might be lagging.
+	// If the convert and encode threads are that far behind, drop the frame instead of holding up the GS thread.
+	// The timestamp still moves on, so the video doesn't drift from the audio.
 	pxAssert(pf.state != PendingFrame::State::NeedsMap);
-	if (pf.state == PendingFrame::State::NeedsEncoding)
+	if (pf.state != PendingFrame::State::Unused)
 	{
-		s_frame_encoded_cv.wait(lock, [&pf]() { return pf.state == PendingFrame::State::Unused; });
+		s_next_video_pts++;
+		s_dropped_frames.fetch_add(1, std::memory_order_relaxed);
+		return true;
 	}
 
 	if (!pf.tex || pf.tex->GetWidth() != static_cast<u32>(stex->GetWidth()) || pf.tex->GetHeight() != static_cast<u32>(stex->GetHeight()))
@@ -916,12 +945,50 @@ void GSCapture::ProcessFramePendingMap(std::unique_lock<std::mutex>& lock)
 
 	lock.lock();
 
-	// Kick to encoder thread!
-	pf.state = PendingFrame::State::NeedsEncoding;
+	// Kick to convert threads!
+	pf.state = PendingFrame::State::NeedsConversion;
 	s_frames_map_consume_pos = (s_frames_map_consume_pos + 1) % MAX_PENDING_FRAMES;
 	s_frames_pending_map--;
 	s_frames_pending_encode++;
-	s_frame_ready_cv.notify_one();
+	s_frame_convert_cv.notify_one();
+}
+
+void GSCapture::ConvertThreadEntryPoint(u32 index)
+{
+	Threading::SetNameOfCurrentThread("GS Capture Conversion");
+
+	std::unique_lock<std::mutex> lock(s_lock);
+
+	for (;;)
+	{
+		s_frame_convert_cv.wait(lock, []() {
+			return (s_pending_frames[s_frames_convert_consume_pos].state == PendingFrame::State::NeedsConversion ||
+					!s_capturing.load(std::memory_order_acquire));
+		});
+		if (!s_capturing.load(std::memory_order_acquire))
+			break;
+
+		const u32 pos = s_frames_convert_consume_pos;
+		PendingFrame& pf = s_pending_frames[pos];
+		pf.state = PendingFrame::State::Converting;
+		s_frames_convert_consume_pos = (s_frames_convert_consume_pos + 1) % MAX_PENDING_FRAMES;
+
+		lock.unlock();
+
+		// If the frame failed to map, leave it for the encode thread to skip.
+		bool okay = true;
+		if (!s_encoding_error && pf.tex->IsMapped())
+			okay = ConvertFrame(pf, s_converted_video_frames[pos], &s_sws_contexts[index]);
+
+		lock.lock();
+
+		if (!okay)
+			s_encoding_error = true;
+
+		// Frames can finish converting out of order, the encoder waits for the one it needs next.
+		pf.state = PendingFrame::State::NeedsEncoding;
+		s_frame_ready_cv.notify_one();
+	}
 }
 
 void GSCapture::EncoderThreadEntryPoint()
@@ -932,12 +999,14 @@ void GSCapture::EncoderThreadEntryPoint()
 
 	for (;;)
 	{
-		s_frame_ready_cv.wait(lock, []() { return (s_frames_pending_encode > 0 || !s_capturing.load(std::memory_order_acquire)); });
-		if (s_frames_pending_encode == 0 && !s_capturing.load(std::memory_order_acquire))
-			break;
+		s_frame_ready_cv.wait(lock, []() {
+			return (s_pending_frames[s_frames_encode_consume_pos].state == PendingFrame::State::NeedsEncoding ||
+					!s_capturing.load(std::memory_order_acquire));
+		});
 
 		PendingFrame& pf = s_pending_frames[s_frames_encode_consume_pos];
-		pxAssert(pf.state == PendingFrame::State::NeedsEncoding);
+		if (pf.state != PendingFrame::State::NeedsEncoding)
+			break;
 
 		lock.unlock();
 
@@ -945,7 +1014,7 @@ void GSCapture::EncoderThreadEntryPoint()
 
 		// If the frame failed to map, this will be false, and we'll just skip it.
 		if (okay && s_video_stream && pf.tex->IsMapped())
-			okay = SendFrame(pf);
+			okay = SendFrame(pf, s_converted_video_frames[s_frames_encode_consume_pos]);
 
 		// Encode as many audio frames while the video is ahead.
 		if (okay && s_audio_stream)
@@ -970,6 +1039,12 @@ void GSCapture::StartEncoderThread()
 	Console.WriteLn("GSCapture: Starting encoder thread.");
 	pxAssert(s_capturing.load(std::memory_order_acquire) && !s_encoder_thread.Joinable());
 	s_encoder_thread.Start(EncoderThreadEntryPoint);
+
+	if (s_video_stream)
+	{
+		for (u32 i = 0; i < NUM_CONVERT_THREADS; i++)
+			s_convert_threads[i].Start([i]() { ConvertThreadEntryPoint(i); });
+	}
 }
 
 void GSCapture::StopEncoderThread(std::unique_lock<std::mutex>& lock)
@@ -981,15 +1056,21 @@ void GSCapture::StopEncoderThread(std::unique_lock<std::mutex>& lock)
 	{
 		Console.WriteLn("GSCapture: Stopping encoder thread.");
 
-		// Might be sleeping, so wake it before joining.
+		// Might be sleeping, so wake them before joining.
+		s_frame_convert_cv.notify_all();
 		s_frame_ready_cv.notify_one();
 		lock.unlock();
+		for (Threading::Thread& thread : s_convert_threads)
+		{
+			if (thread.Joinable())
+				thread.Join();
+		}
 		s_encoder_thread.Join();
 		lock.lock();
 	}
 }
 
-bool GSCapture::SendFrame(const PendingFrame& pf)
+bool GSCapture::ConvertFrame(const PendingFrame& pf, AVFrame* frame, SwsContext** sws_context)
 {
 	const AVPixelFormat source_format = AV_PIX_FMT_RGBA;
 	const u8* source_ptr = pf.tex->GetMapPointer();
@@ -997,25 +1078,29 @@ bool GSCapture::SendFrame(const PendingFrame& pf)
 	const int source_height = static_cast<int>(pf.tex->GetHeight());
 	const int source_pitch = static_cast<int>(pf.tex->GetMapPitch());
 
-	// In case a previous frame is still using the frame.
-	wrap_av_frame_make_writable(s_converted_video_frame);
+	// In case the encoder is still holding on to the last frame converted into this one.
+	wrap_av_frame_make_writable(frame);
 
-	s_sws_context = wrap_sws_getCachedContext(s_sws_context, source_width, source_height, source_format, s_converted_video_frame->width,
-		s_converted_video_frame->height, static_cast<AVPixelFormat>(s_converted_video_frame->format), SWS_BICUBIC, nullptr, nullptr, nullptr);
-	if (!s_sws_context)
+	*sws_context = wrap_sws_getCachedContext(*sws_context, source_width, source_height, source_format, frame->width,
+		frame->height, static_cast<AVPixelFormat>(frame->format), SWS_BICUBIC, nullptr, nullptr, nullptr);
+	if (!*sws_context)
 	{
 		Console.Error("sws_getCachedContext() failed");
 		return false;
 	}
 
-	wrap_sws_scale(s_sws_context, reinterpret_cast<const u8**>(&source_ptr), &source_pitch, 0, source_height, s_converted_video_frame->data,
-		s_converted_video_frame->linesize);
+	wrap_sws_scale(*sws_context, reinterpret_cast<const u8**>(&source_ptr), &source_pitch, 0, source_height, frame->data,
+		frame->linesize);
+	return true;
+}
 
-	AVFrame* frame_to_send = s_converted_video_frame;
+bool GSCapture::SendFrame(const PendingFrame& pf, AVFrame* frame)
+{
+	AVFrame* frame_to_send = frame;
 	if (IsUsingHardwareVideoEncoding())
 	{
 		// Need to transfer the frame to hardware.
-		const int res = wrap_av_hwframe_transfer_data(s_hw_video_frame, s_converted_video_frame, 0);
+		const int res = wrap_av_hwframe_transfer_data(s_hw_video_frame, frame, 0);
 		if (res < 0)
 		{
 			LogAVError(res, "av_hwframe_transfer_data() failed: ");
@@ -1267,6 +1352,7 @@ void GSCapture::InternalEndCapture(std::unique_lock<std::mutex>& lock)
 		s_pending_frames_pos = 0;
 		s_frames_pending_map = 0;
 		s_frames_map_consume_pos = 0;
+		s_frames_convert_consume_pos = 0;
 		s_frames_pending_encode = 0;
 		s_frames_encode_consume_pos = 0;
 
@@ -1278,6 +1364,9 @@ void GSCapture::InternalEndCapture(std::unique_lock<std::mutex>& lock)
 		s_filename = {};
 		s_encoding_error = false;
 
+		if (const u32 dropped_frames = s_dropped_frames.load(std::memory_order_relaxed); dropped_frames > 0)
+			Console.Warning("GSCapture: Dropped %u frames because encoding couldn't keep up.", dropped_frames);
+
 		// end of stream
 		if (s_video_stream)
 		{
@@ -1309,15 +1398,21 @@ void GSCapture::InternalEndCapture(std::unique_lock<std::mutex>& lock)
 			LogAVError(res, "avio_closep() failed: ");
 	}
 
-	if (s_sws_context)
+	for (SwsContext*& sws_context : s_sws_contexts)
 	{
-		wrap_sws_freeContext(s_sws_context);
-		s_sws_context = nullptr;
+		if (sws_context)
+		{
+			wrap_sws_freeContext(sws_context);
+			sws_context = nullptr;
+		}
 	}
 	if (s_video_packet)
 		wrap_av_packet_free(&s_video_packet);
-	if (s_converted_video_frame)
-		wrap_av_frame_free(&s_converted_video_frame);
+	for (AVFrame*& frame : s_converted_video_frames)
+	{
+		if (frame)
+			wrap_av_frame_free(&frame);
+	}
 	if (s_hw_video_frame)
 		wrap_av_frame_free(&s_hw_video_frame);
 	if (s_video_hw_frames)
@@ -1402,9 +1497,18 @@ TinyString GSCapture::GetElapsedTime()
 	return ret;
 }
 
-const Threading::ThreadHandle& GSCapture::GetEncoderThreadHandle()
+u64 GSCapture::GetEncoderThreadsCPUTime()
+{
+	u64 time = s_encoder_thread.GetCPUTime();
+	for (const Threading::Thread& thread : s_convert_threads)
+		time += thread.GetCPUTime();
+
+	return time;
+}
+
+u32 GSCapture::GetDroppedFrameCount()
 {
-	return s_encoder_thread;
+	return s_dropped_frames.load(std::memory_order_relaxed);
 }
 
 GSVector2i GSCapture::GetSize()
@@ -9,11 +9,6 @@
 #include "common/SmallString.h"
 #include "GSVector.h"
 
-namespace Threading
-{
-class ThreadHandle;
-}
-
 class GSTexture;
 class GSDownloadTexture;
 
@@ -28,7 +23,8 @@ namespace GSCapture
 	bool IsCapturingVideo();
 	bool IsCapturingAudio();
 	TinyString GetElapsedTime();
-	const Threading::ThreadHandle& GetEncoderThreadHandle();
+	u64 GetEncoderThreadsCPUTime(); // conversion and encoding
+	u32 GetDroppedFrameCount();
 	GSVector2i GetSize();
 	std::string GetNextCaptureFileName();
 	void Flush();
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <numbers>
 
 //#define LOG_UNDERRUN(...) DEV_LOG(__VA_ARGS__)
 #define LOG_UNDERRUN(...) (void)0
@@ -461,6 +462,8 @@ void AudioStream::EmptyBuffer()
 		m_soundtouch->clear();
 		if (IsStretchEnabled())
 			m_soundtouch->setTempo(m_nominal_rate);
+		if (m_resampling)
+			ResampleReset(true);
 	}
 
 	m_wpos.store(m_rpos.load(std::memory_order_acquire), std::memory_order_release);
@@ -487,6 +490,7 @@ void AudioStream::UpdateTargetTempo(float tempo)
 	m_stretch_reset = 0;
 	m_stretch_inactive = false;
 	m_stretch_ok_count = 0;
+	m_resampling = false;
 	m_dynamic_target_usage = static_cast<float>(m_target_buffer_size) * m_nominal_rate;
 }
 
@@ -692,28 +696,71 @@ void AudioStream::StretchAllocate()
 	m_average_available = 0;
 
 	m_staging_buffer_pos = 0;
+
+	m_resampling = false;
+	m_resample_input = std::make_unique<float[]>((RESAMPLE_TAPS + CHUNK_SIZE) * m_internal_channels);
+	m_resample_output = std::make_unique<s16[]>(RESAMPLE_MAX_OUTPUT_FRAMES * m_internal_channels);
+	ResampleReset(true);
 }
 
 void AudioStream::StretchDestroy()
 {
 	m_soundtouch.reset();
+	m_resample_output.reset();
+	m_resample_input.reset();
+	m_resampling = false;
 }
 
 void AudioStream::StretchWriteBlock(const float* block)
 {
 	if (IsStretchEnabled())
 	{
-		m_soundtouch->putSamples(block, CHUNK_SIZE);
+		const auto receive_samples = [this]() {
+			u32 tempProgress;
+			while (tempProgress = m_soundtouch->receiveSamples(m_float_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+			{
+				FloatChunkToS16(m_staging_buffer.get(), m_float_buffer.get(), tempProgress * m_internal_channels);
+				InternalWriteFrames(m_staging_buffer.get(), tempProgress);
+				ResampleSaveHistory(m_float_buffer.get(), tempProgress);
+			}
+		};
 
-		u32 tempProgress;
-		while (tempProgress = m_soundtouch->receiveSamples(m_float_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+		if (m_resampling)
 		{
-			FloatChunkToS16(m_staging_buffer.get(), m_float_buffer.get(), tempProgress * m_internal_channels);
-			InternalWriteFrames(m_staging_buffer.get(), tempProgress);
+			ResampleWriteBlock(block);
+			UpdateStretchTempo();
+
+			// Buffer drifted too far for the resampler to pull back without being audible, or we're fast forwarding.
+			if (!m_stretch_inactive || m_nominal_rate != 1.0f)
+			{
+				LOG_UNDERRUN("~~~ Switching from resampler to stretcher.");
+				m_resampling = false;
+			}
+			else
+			{
+				UpdateResampleRate();
+			}
+
+			return;
 		}
 
+		m_soundtouch->putSamples(block, CHUNK_SIZE);
+		receive_samples();
+
 		if (IsStretchEnabled())
 			UpdateStretchTempo();
+
+		// At the nominal rate with the buffer where it should be, SoundTouch is just adding latency and burning CPU.
+		// Flush out what it's holding on to, and let the resampler keep the buffer level from here.
+		if (m_stretch_inactive && m_nominal_rate == 1.0f)
+		{
+			LOG_UNDERRUN("=== Switching from stretcher to resampler.");
+			m_soundtouch->flush();
+			receive_samples();
+			m_soundtouch->clear();
+			ResampleReset(false);
+			m_resampling = true;
+		}
 	}
 	else
 	{
@@ -836,6 +883,122 @@ void AudioStream::UpdateStretchTempo()
 		m_stretch_reset = 0;
 }
 
+void AudioStream::ResampleReset(bool clear_history)
+{
+	// When switching over from the stretcher, the history holds the last frames it output, so the filter carries on
+	// from them instead of ramping up from silence.
+	if (clear_history)
+		std::memset(m_resample_input.get(), 0, RESAMPLE_TAPS * m_internal_channels * sizeof(float));
+
+	// Centre the first output frame on the first frame of the next block, since everything in the history has
+	// already been output (or is silence).
+	m_resample_pos = static_cast<double>(RESAMPLE_TAPS - (RESAMPLE_TAPS / 2 - 1));
+	m_resample_step = 1.0;
+	m_resample_average_fill = static_cast<float>(GetBufferedFramesRelaxed());
+}
+
+void AudioStream::ResampleSaveHistory(const float* frames, u32 count)
+{
+	const u32 channels = m_internal_channels;
+	const u32 keep = std::min(count, RESAMPLE_TAPS);
+	float* const history = m_resample_input.get();
+	std::memmove(history, &history[keep * channels], (RESAMPLE_TAPS - keep) * channels * sizeof(float));
+	std::memcpy(&history[(RESAMPLE_TAPS - keep) * channels], &frames[(count - keep) * channels], keep * channels * sizeof(float));
+}
+
+void AudioStream::ResampleWriteBlock(const float* block)
+{
+	static constexpr u32 HALF_TAPS = RESAMPLE_TAPS / 2;
+
+	// Blackman windowed sinc, one row per fractional offset. The extra row lets us interpolate between the last phase
+	// and the next input frame.
+	static const auto filter = []() {
+		static constexpr double CUTOFF = 0.9;
+
+		std::array<std::array<float, RESAMPLE_TAPS>, RESAMPLE_PHASES + 1> ret;
+		for (u32 phase = 0; phase <= RESAMPLE_PHASES; phase++)
+		{
+			std::array<double, RESAMPLE_TAPS> coeffs;
+			double sum = 0.0;
+			for (u32 tap = 0; tap < RESAMPLE_TAPS; tap++)
+			{
+				const double x = static_cast<double>(tap) - static_cast<double>(HALF_TAPS - 1) -
+								 (static_cast<double>(phase) / static_cast<double>(RESAMPLE_PHASES));
+				const double px = std::numbers::pi * CUTOFF * x;
+				const double sinc = (x == 0.0) ? 1.0 : (std::sin(px) / px);
+				const double wx = (2.0 * std::numbers::pi * x) / static_cast<double>(RESAMPLE_TAPS);
+				const double window = 0.42 + 0.5 * std::cos(wx) + 0.08 * std::cos(2.0 * wx);
+				coeffs[tap] = sinc * window;
+				sum += coeffs[tap];
+			}
+
+			// Normalize for unity gain at DC.
+			for (u32 tap = 0; tap < RESAMPLE_TAPS; tap++)
+				ret[phase][tap] = static_cast<float>(coeffs[tap] / sum);
+		}
+
+		return ret;
+	}();
+
+	const u32 channels = m_internal_channels;
+	float* const input = m_resample_input.get();
+	std::memcpy(&input[RESAMPLE_TAPS * channels], block, CHUNK_SIZE * channels * sizeof(float));
+
+	SampleType* out = m_resample_output.get();
+	u32 out_frames = 0;
+	while (m_resample_pos < static_cast<double>(CHUNK_SIZE))
+	{
+		pxAssert(out_frames < RESAMPLE_MAX_OUTPUT_FRAMES);
+
+		const u32 base = static_cast<u32>(m_resample_pos);
+		const float phase = static_cast<float>(m_resample_pos - static_cast<double>(base)) * RESAMPLE_PHASES;
+		const u32 phase_index = std::min(static_cast<u32>(phase), RESAMPLE_PHASES - 1);
+		const float phase_frac = phase - static_cast<float>(phase_index);
+
+		const std::array<float, RESAMPLE_TAPS>& c0 = filter[phase_index];
+		const std::array<float, RESAMPLE_TAPS>& c1 = filter[phase_index + 1];
+		std::array<float, RESAMPLE_TAPS> coeffs;
+		for (u32 tap = 0; tap < RESAMPLE_TAPS; tap++)
+			coeffs[tap] = c0[tap] + (c1[tap] - c0[tap]) * phase_frac;
+
+		const float* in = &input[base * channels];
+		for (u32 ch = 0; ch < channels; ch++)
+		{
+			float sum = 0.0f;
+			for (u32 tap = 0; tap < RESAMPLE_TAPS; tap++)
+				sum += in[tap * channels + ch] * coeffs[tap];
+
+			*(out++) = static_cast<SampleType>(std::clamp(sum * 32767.0f, -32768.0f, 32767.0f));
+		}
+
+		out_frames++;
+		m_resample_pos += m_resample_step;
+	}
+
+	// Keep the tail of this block around for the next one's taps.
+	static_assert(CHUNK_SIZE >= RESAMPLE_TAPS);
+	std::memcpy(input, &input[CHUNK_SIZE * channels], RESAMPLE_TAPS * channels * sizeof(float));
+	m_resample_pos -= static_cast<double>(CHUNK_SIZE);
+
+	InternalWriteFrames(m_resample_output.get(), out_frames);
+}
+
+void AudioStream::UpdateResampleRate()
+{
+	// Keep the correction under half a percent, so the pitch change isn't noticeable. If that's not enough to hold the
+	// buffer, UpdateStretchTempo() will wake the stretcher back up.
+	static constexpr float FILL_SMOOTHING = 0.02f;
+	static constexpr double RATE_GAIN = 0.01;
+	static constexpr double MAX_RATE_ADJUSTMENT = 0.005;
+
+	const float fill = static_cast<float>(GetBufferedFramesRelaxed());
+	m_resample_average_fill += (fill - m_resample_average_fill) * FILL_SMOOTHING;
+
+	// Stepping through the input faster produces fewer frames, draining the buffer.
+	const double error = static_cast<double>(m_resample_average_fill) / static_cast<double>(m_target_buffer_size) - 1.0;
+	m_resample_step = 1.0 + std::clamp(error * RATE_GAIN, -MAX_RATE_ADJUSTMENT, MAX_RATE_ADJUSTMENT);
+}
+
 void AudioStream::StretchUnderrun()
 {
 	// Didn't produce enough frames in time.
@@ -139,6 +139,11 @@ private:
 	static constexpr u32 STRETCH_RESET_THRESHOLD = 5;
 	static constexpr u32 TARGET_IPS = 691;
 
+	// Polyphase resampler used instead of SoundTouch when running at 100% speed.
+	static constexpr u32 RESAMPLE_TAPS = 16;
+	static constexpr u32 RESAMPLE_PHASES = 64;
+	static constexpr u32 RESAMPLE_MAX_OUTPUT_FRAMES = CHUNK_SIZE + 2;
+
 	static std::vector<std::pair<std::string, std::string>> GetCubebDriverNames();
 	static std::vector<DeviceInfo> GetCubebOutputDevices(const char* driver);
 	static std::unique_ptr<AudioStream> CreateCubebAudioStream(u32 sample_rate, const AudioStreamParameters& parameters,
@@ -163,6 +168,11 @@ private:
 	float AddAndGetAverageTempo(float val);
 	void UpdateStretchTempo();
 
+	void ResampleReset(bool clear_history);
+	void ResampleSaveHistory(const float* frames, u32 count);
+	void ResampleWriteBlock(const float* block);
+	void UpdateResampleRate();
+
 	u32 m_buffer_size = 0;
 	std::unique_ptr<s16[]> m_buffer;
 	SampleReader m_sample_reader = nullptr;
@@ -185,6 +195,17 @@ private:
 
 	std::array<float, AVERAGING_BUFFER_SIZE> m_average_fullness = {};
 
+	// When the stretcher is inactive at the nominal rate, blocks skip SoundTouch and go through the resampler instead,
+	// which nudges its rate to keep the buffer around the target size.
+	bool m_resampling = false;
+	double m_resample_pos = 0.0;
+	double m_resample_step = 1.0;
+	float m_resample_average_fill = 0.0f;
+
+	// previous RESAMPLE_TAPS frames followed by the current block
+	std::unique_ptr<float[]> m_resample_input;
+	std::unique_ptr<s16[]> m_resample_output;
+
 	// temporary staging buffer, used for timestretching
 	std::unique_ptr<s16[]> m_staging_buffer;
 
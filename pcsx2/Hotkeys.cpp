@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Achievements.h"
+#include "DebugTools/GuestProfiler.h"
 #include "GS.h"
 #include "Host.h"
 #include "IconsFontAwesome5.h"
@@ -218,6 +219,11 @@ DEFINE_HOTKEY("InputRecToggleMode", TRANSLATE_NOOP("Hotkeys", "System"),
 		if (!pressed && VMManager::HasValidVM())
 			g_InputRecording.getControls().toggleRecordMode();
 	})
+DEFINE_HOTKEY("ToggleGuestProfiler", TRANSLATE_NOOP("Hotkeys", "System"),
+	TRANSLATE_NOOP("Hotkeys", "Toggle Guest Profiler"), [](s32 pressed) {
+		if (!pressed && VMManager::HasValidVM())
+			Host::RunOnCPUThread(&GuestProfiler::Toggle);
+	})
 
 DEFINE_HOTKEY("PreviousSaveStateSlot", TRANSLATE_NOOP("Hotkeys", "Save States"),
 	TRANSLATE_NOOP("Hotkeys", "Select Previous Save Slot"), [](s32 pressed) {
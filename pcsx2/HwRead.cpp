@@ -4,6 +4,7 @@
 #include "Common.h"
 #include "Hardware.h"
 #include "IopHw.h"
+#include "MTIOP.h"
 #include "ps2/HwInternal.h"
 #include "ps2/eeHwTraceLog.inl"
 
@@ -73,6 +74,10 @@ mem32_t _hwRead32(u32 mem)
 				return psHu32(INTC_STAT);
 			}
 
+			// The IOP side of the SIF mailboxes could be changing on the IOP thread.
+			if ((mem & 0xffffff00) == SBUS_F200)
+				iopThread.WaitIOP();
+
 			// todo: psx mode: this is new
 			if (((mem & 0x1FFFFFFF) >= EEMemoryMap::SBUS_PS1_Start) && ((mem & 0x1FFFFFFF) < EEMemoryMap::SBUS_PS1_End)) {
 				return PGIFr((mem & 0x1FFFFFFF));
@@ -211,6 +216,10 @@ mem32_t hwRead32_page_0F_INTC_HACK(u32 mem)
 template< uint page >
 mem8_t _hwRead8(u32 mem)
 {
+	// Same as the 32-bit read, the SIF mailboxes could be changing on the IOP thread.
+	if (page == 0x0f && (mem & 0xffffff00) == SBUS_F200)
+		iopThread.WaitIOP();
+
 	u32 ret32 = _hwRead32<page, false>(mem & ~0x03);
 	return ((u8*)&ret32)[mem & 0x03];
 }
@@ -228,6 +237,9 @@ mem16_t _hwRead16(u32 mem)
 {
 	pxAssume( (mem & 0x01) == 0 );
 
+	if (page == 0x0f && (mem & 0xffffff00) == SBUS_F200)
+		iopThread.WaitIOP();
+
 	u32 ret32 = _hwRead32<page, false>(mem & ~0x03);
 	return ((u16*)&ret32)[(mem>>1) & 0x01];
 }
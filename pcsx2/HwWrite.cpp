@@ -5,6 +5,7 @@
 #include "Hardware.h"
 #include "Gif_Unit.h"
 #include "IopMem.h"
+#include "MTIOP.h"
 
 #include "ps2/HwInternal.h"
 #include "ps2/eeHwTraceLog.inl"
@@ -127,6 +128,10 @@ void _hwWrite32( u32 mem, u32 value )
 
 		case 0x0f:
 		{
+			// The IOP side of the SIF mailboxes could be changing on the IOP thread.
+			if ((mem & 0xffffff00) == SBUS_F200)
+				iopThread.WaitIOP();
+
 			switch( HELPSWITCH(mem) )
 			{
 				mcase(INTC_STAT):
@@ -277,6 +282,10 @@ void _hwWrite8(u32 mem, u8 value)
 #if PSX_EXTRALOGS
 	if ((mem & 0x1000ff00) == 0x1000f300) DevCon.Warning("8bit Write to SIF Register %x value %x wibble", mem, value);
 #endif
+	// Wait before the read-modify-write below, so the IOP can't change the rest of the register in between.
+	if (page == 0x0f && (mem & 0xffffff00) == SBUS_F200)
+		iopThread.WaitIOP();
+
 	if (mem == SIO_TXFIFO)
 	{
 		static bool included_newline = false;
@@ -334,6 +343,9 @@ void _hwWrite16(u32 mem, u16 value)
 #if PSX_EXTRALOGS
 	if ((mem & 0x1000ff00) == 0x1000f300) DevCon.Warning("16bit Write to SIF Register %x wibble", mem);
 #endif
+	if (page == 0x0f && (mem & 0xffffff00) == SBUS_F200)
+		iopThread.WaitIOP();
+
 	switch(mem & ~3)
 	{
 		case DMAC_STAT:
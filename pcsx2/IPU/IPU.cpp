@@ -89,6 +89,8 @@ __fi void IPUProcessInterrupt()
 
 void ipuReset()
 {
+	ipuThread.WaitIPU();
+
 	IPUWorker = MULTI_ISA_SELECT(IPUWorker);
 	std::memset(&ipuRegs, 0, sizeof(ipuRegs));
 	std::memset(&g_BP, 0, sizeof(g_BP));
@@ -120,6 +122,8 @@ void ReportIPU()
 
 bool SaveStateBase::ipuFreeze()
 {
+	ipuThread.WaitIPU();
+
 	// Get a report of the status of the ipu variables when saving and loading savestates.
 	//ReportIPU();
 	if (!FreezeTag("IPU"))
@@ -215,6 +219,8 @@ void tIPU_CMD_CSC::log_from_RGB32() const
 
 __fi u32 ipuRead32(u32 mem)
 {
+	ipuThread.WaitIPU();
+
 	// Note: It's assumed that mem's input value is always in the 0x10002000 page
 	// of memory (if not, it's probably bad code).
 
@@ -265,6 +271,8 @@ __fi u32 ipuRead32(u32 mem)
 
 __fi u64 ipuRead64(u32 mem)
 {
+	ipuThread.WaitIPU();
+
 	// Note: It's assumed that mem's input value is always in the 0x10002000 page
 	// of memory (if not, it's probably bad code).
 
@@ -325,6 +333,8 @@ void ipuSoftReset()
 
 __fi bool ipuWrite32(u32 mem, u32 value)
 {
+	ipuThread.WaitIPU();
+
 	// Note: It's assumed that mem's input value is always in the 0x10002000 page
 	// of memory (if not, it's probably bad code).
 
@@ -360,6 +370,8 @@ __fi bool ipuWrite32(u32 mem, u32 value)
 // writeback itself.
 __fi bool ipuWrite64(u32 mem, u64 value)
 {
+	ipuThread.WaitIPU();
+
 	// Note: It's assumed that mem's input value is always in the 0x10002000 page
 	// of memory (if not, it's probably bad code).
 
@@ -6,13 +6,14 @@
 #include "IPU_Fifo.h"
 #include "IPUdma.h"
 #include "Common.h"
+#include "IPU_Thread.h"
 
 #define ipumsk( src ) ( (src) & 0xff )
 #define ipucase( src ) case ipumsk(src)
 
-#define IPU_INT_TO( cycles )  if(!(cpuRegs.interrupt & (1<<4))) CPU_INT( DMAC_TO_IPU, cycles )
-#define IPU_INT_FROM( cycles )  CPU_INT( DMAC_FROM_IPU, cycles )
-#define IPU_INT_PROCESS( cycles ) if(!(cpuRegs.interrupt & (1 << IPU_PROCESS))) CPU_INT( IPU_PROCESS, cycles )
+#define IPU_INT_TO( cycles )  if(!ipuThread.IsEventPending(DMAC_TO_IPU)) ipuThread.RaiseEvent( DMAC_TO_IPU, cycles )
+#define IPU_INT_FROM( cycles )  ipuThread.RaiseEvent( DMAC_FROM_IPU, cycles )
+#define IPU_INT_PROCESS( cycles ) if(!ipuThread.IsEventPending(IPU_PROCESS)) ipuThread.RaiseEvent( IPU_PROCESS, cycles )
 //
 // Bitfield Structures
 //
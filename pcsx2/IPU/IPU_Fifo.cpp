@@ -29,9 +29,9 @@ void IPU_Fifo_Input::clear()
 	// Because the FIFO is drained it will request more data immediately
 	IPUCoreStatus.DataRequested = true;
 
-	if (ipu1ch.chcr.STR && cpuRegs.eCycle[4] == 0x9999)
+	if (ipuThread.GetIPU1Channel().chcr.STR && ipuThread.GetEventCycles(DMAC_TO_IPU) == 0x9999)
 	{
-		CPU_INT(DMAC_TO_IPU, 4);
+		ipuThread.RaiseEvent(DMAC_TO_IPU, 4);
 	}
 }
 
@@ -91,9 +91,10 @@ int IPU_Fifo_Input::read(void *value)
 		// IPU FIFO is empty and DMA is waiting so lets tell the DMA we are ready to put data in the FIFO
 		IPUCoreStatus.DataRequested = true;
 
-		if(ipu1ch.chcr.STR && cpuRegs.eCycle[4] == 0x9999)
+		const DMACh& ch = ipuThread.GetIPU1Channel();
+		if(ch.chcr.STR && ipuThread.GetEventCycles(DMAC_TO_IPU) == 0x9999)
 		{
-			CPU_INT( DMAC_TO_IPU, std::min(8U, ipu1ch.qwc));
+			ipuThread.RaiseEvent( DMAC_TO_IPU, std::min(8U, ch.qwc));
 		}
 
 		if (g_BP.IFC == 0) return 0;
@@ -126,7 +127,7 @@ int IPU_Fifo_Output::write(const u32 *value, uint size)
 
 	ipuRegs.ctrl.OFC += transfer_size;
 
-	if(ipu0ch.chcr.STR)
+	if(ipuThread.GetIPU0Channel().chcr.STR)
 		IPU_INT_FROM(1);
 
 	return transfer_size;
@@ -154,6 +155,8 @@ void IPU_Fifo_Output::read(void *value, uint size)
 
 void ReadFIFO_IPUout(mem128_t* out)
 {
+	ipuThread.WaitIPU();
+
 	pxAssertMsg(ipuRegs.ctrl.OFC > 0, "Attempted read from IPUout's FIFO, but the FIFO is empty!");
 	if (ipuRegs.ctrl.OFC == 0) [[unlikely]]
 		return;
@@ -165,6 +168,8 @@ void ReadFIFO_IPUout(mem128_t* out)
 
 void WriteFIFO_IPUin(const mem128_t* value)
 {
+	ipuThread.WaitIPU();
+
 	IPU_LOG( "WriteFIFO/IPUin <- 0x%08X.%08X.%08X.%08X", value->_u32[0], value->_u32[1], value->_u32[2], value->_u32[3]);
 
 	//committing every 16 bytes
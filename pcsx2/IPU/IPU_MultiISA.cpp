@@ -65,7 +65,6 @@ alignas(16) const mpeg2_scan_pack mpeg2_scan = make_scan_pack();
 MULTI_ISA_UNSHARED_START
 
 static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn);
-static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4);
 
 // --------------------------------------------------------------------------------------
 //  Buffer reader
@@ -213,7 +212,8 @@ __fi static void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
 	t1 = tmp - (w1 + w0) * d0;
 }
 
-__ri static void IDCT_Block(s16* block)
+// Reference for ipu_idct(), which has to match it exactly.
+void ipu_idct_reference(s16* block)
 {
 	for (int i = 0; i < 8; i++)
 	{
@@ -322,9 +322,160 @@ __ri static void IDCT_Block(s16* block)
 	}
 }
 
+#if _M_SSE >= 0x501
+
+// Transposes eight rows of eight 16-bit values, widening each row of the result to 32 bits.
+__fi static void IDCT_Transpose_AVX2(const __m128i* rows, __m256i* out)
+{
+	const __m128i t0 = _mm_unpacklo_epi16(rows[0], rows[1]);
+	const __m128i t1 = _mm_unpackhi_epi16(rows[0], rows[1]);
+	const __m128i t2 = _mm_unpacklo_epi16(rows[2], rows[3]);
+	const __m128i t3 = _mm_unpackhi_epi16(rows[2], rows[3]);
+	const __m128i t4 = _mm_unpacklo_epi16(rows[4], rows[5]);
+	const __m128i t5 = _mm_unpackhi_epi16(rows[4], rows[5]);
+	const __m128i t6 = _mm_unpacklo_epi16(rows[6], rows[7]);
+	const __m128i t7 = _mm_unpackhi_epi16(rows[6], rows[7]);
+
+	const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+	const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+	const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+	const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+	const __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+	const __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+	const __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+	const __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+	out[0] = _mm256_cvtepi16_epi32(_mm_unpacklo_epi64(u0, u4));
+	out[1] = _mm256_cvtepi16_epi32(_mm_unpackhi_epi64(u0, u4));
+	out[2] = _mm256_cvtepi16_epi32(_mm_unpacklo_epi64(u1, u5));
+	out[3] = _mm256_cvtepi16_epi32(_mm_unpackhi_epi64(u1, u5));
+	out[4] = _mm256_cvtepi16_epi32(_mm_unpacklo_epi64(u2, u6));
+	out[5] = _mm256_cvtepi16_epi32(_mm_unpackhi_epi64(u2, u6));
+	out[6] = _mm256_cvtepi16_epi32(_mm_unpacklo_epi64(u3, u7));
+	out[7] = _mm256_cvtepi16_epi32(_mm_unpackhi_epi64(u3, u7));
+}
+
+__fi static void BUTTERFLY_AVX2(__m256i& t0, __m256i& t1, int w0, int w1, __m256i d0, __m256i d1)
+{
+	const __m256i tmp = _mm256_mullo_epi32(_mm256_set1_epi32(w0), _mm256_add_epi32(d0, d1));
+	t0 = _mm256_add_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32(w1 - w0), d1));
+	t1 = _mm256_sub_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32(w1 + w0), d0));
+}
+
+template <int shift>
+__fi static __m256i IDCT_Output_AVX2(__m256i v)
+{
+	return _mm256_srai_epi32(_mm256_slli_epi32(_mm256_srai_epi32(v, shift), 16), 16);
+}
+
+// One pass of ipu_idct_reference() over all eight rows (or columns) at once, d[k] holding the k-th
+// coefficient of each. The results are truncated to 16 bits, as storing them back into the block would.
+template <bool columns>
+__fi static void IDCT_Pass_AVX2(__m256i* d)
+{
+	__m256i a0, a1, a2, a3;
+	{
+		const __m256i d0 = _mm256_add_epi32(_mm256_slli_epi32(d[0], 11), _mm256_set1_epi32(columns ? 65536 : 128));
+		const __m256i d2 = _mm256_slli_epi32(d[2], 11);
+		const __m256i t0 = _mm256_add_epi32(d0, d2);
+		const __m256i t1 = _mm256_sub_epi32(d0, d2);
+		__m256i t2, t3;
+		BUTTERFLY_AVX2(t2, t3, W6, W2, d[3], d[1]);
+		a0 = _mm256_add_epi32(t0, t2);
+		a1 = _mm256_add_epi32(t1, t3);
+		a2 = _mm256_sub_epi32(t1, t3);
+		a3 = _mm256_sub_epi32(t0, t2);
+	}
+
+	__m256i b0, b1, b2, b3;
+	{
+		__m256i t0, t1, t2, t3;
+		BUTTERFLY_AVX2(t0, t1, W7, W1, d[7], d[4]);
+		BUTTERFLY_AVX2(t2, t3, W3, W5, d[5], d[6]);
+		b0 = _mm256_add_epi32(t0, t2);
+		b3 = _mm256_add_epi32(t1, t3);
+		t0 = _mm256_sub_epi32(t0, t2);
+		t1 = _mm256_sub_epi32(t1, t3);
+
+		const __m256i c181 = _mm256_set1_epi32(181);
+		if constexpr (columns)
+		{
+			t0 = _mm256_srai_epi32(t0, 8);
+			t1 = _mm256_srai_epi32(t1, 8);
+			b1 = _mm256_mullo_epi32(_mm256_add_epi32(t0, t1), c181);
+			b2 = _mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), c181);
+		}
+		else
+		{
+			b1 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_add_epi32(t0, t1), c181), 8);
+			b2 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), c181), 8);
+		}
+	}
+
+	constexpr int shift = columns ? 17 : 8;
+	d[0] = IDCT_Output_AVX2<shift>(_mm256_add_epi32(a0, b0));
+	d[1] = IDCT_Output_AVX2<shift>(_mm256_add_epi32(a1, b1));
+	d[2] = IDCT_Output_AVX2<shift>(_mm256_add_epi32(a2, b2));
+	d[3] = IDCT_Output_AVX2<shift>(_mm256_add_epi32(a3, b3));
+	d[4] = IDCT_Output_AVX2<shift>(_mm256_sub_epi32(a3, b3));
+	d[5] = IDCT_Output_AVX2<shift>(_mm256_sub_epi32(a2, b2));
+	d[6] = IDCT_Output_AVX2<shift>(_mm256_sub_epi32(a1, b1));
+	d[7] = IDCT_Output_AVX2<shift>(_mm256_sub_epi32(a0, b0));
+}
+
+// Runs the row pass with a row per lane, and the column pass with a column per lane, so the eight
+// butterflies of each pass happen together, and the output comes out a row per vector.
+__ri void ipu_idct(s16* block)
+{
+	__m128i rows[8];
+	__m256i d[8];
+
+	for (int i = 0; i < 8; i++)
+		rows[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(block + 8 * i));
+	IDCT_Transpose_AVX2(rows, d);
+	IDCT_Pass_AVX2<false>(d);
+
+	// d[k] holds the k-th result of each row, which is the k-th column of the intermediate block.
+	for (int k = 0; k < 8; k++)
+		rows[k] = _mm_packs_epi32(_mm256_castsi256_si128(d[k]), _mm256_extracti128_si256(d[k], 1));
+	IDCT_Transpose_AVX2(rows, d);
+	IDCT_Pass_AVX2<true>(d);
+
+	for (int k = 0; k < 8; k += 2)
+	{
+		const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(d[k], d[k + 1]), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(block + 8 * k), packed);
+	}
+}
+
+#else
+
+__ri void ipu_idct(s16* block)
+{
+	ipu_idct_reference(block);
+}
+
+#endif
+
 __ri static void IDCT_Copy(s16* block, u8* dest, const int stride)
 {
-	IDCT_Block(block);
+	ipu_idct(block);
+
+#if _M_SSE >= 0x501
+	// Saturating is equivalent to the clip table for any output a legal stream can produce.
+	const __m256i zero = _mm256_setzero_si256();
+	for (int i = 0; i < 8; i += 2)
+	{
+		const __m128i pixels = _mm_packus_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(block)),
+			_mm_load_si128(reinterpret_cast<const __m128i*>(block + 8)));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dest), pixels);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(dest + stride), _mm_unpackhi_epi64(pixels, pixels));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(block), zero);
+
+		dest += stride * 2;
+		block += 16;
+	}
+#else
 
 	for (int i = 0; i < 8; i++)
 	{
@@ -342,6 +493,7 @@ __ri static void IDCT_Copy(s16* block, u8* dest, const int stride)
 		dest += stride;
 		block += 8;
 	}
+#endif
 }
 
 
@@ -352,7 +504,7 @@ __ri static void IDCT_Add(const int last, s16* block, s16* dest, const int strid
 
 	if (last != 129 || (block[0] & 7) == 4)
 	{
-		IDCT_Block(block);
+		ipu_idct(block);
 
 		const r128 zero = r128_zero();
 		for (int i = 0; i < 8; i++)
@@ -951,6 +1103,13 @@ __ri static bool slice_non_intra_DCT(s16 * const dest, const int stride, const b
 	return true;
 }
 
+// Returns true if IPU0 is running and the output FIFO has been drained, so the next macroblock can go out.
+__fi static bool IPU0Ready()
+{
+	const DMACh& ch = ipuThread.GetIPU0Channel();
+	return (ch.chcr.STR && !ipuRegs.ctrl.OFC && ch.qwc != 0);
+}
+
 __fi static void finishmpeg2sliceIDEC()
 {
 	ipuRegs.ctrl.SCD = 0;
@@ -985,7 +1144,7 @@ __ri static bool mpeg2sliceIDEC()
 		while (1)
 		{
 			// IPU0 isn't ready for data, so let's wait for it to be
-			if ((!ipu0ch.chcr.STR || ipuRegs.ctrl.OFC || ipu0ch.qwc == 0) && ipu_cmd.pos[1] <= 2)
+			if (!IPU0Ready() && ipu_cmd.pos[1] <= 2)
 			{
 				IPUCoreStatus.WaitingOnIPUFrom = true;
 				return false;
@@ -1288,7 +1447,7 @@ __fi static bool mpeg2_slice()
 		ipu_cmd.pos[0] = 2;
 
 		// IPU0 isn't ready for data, so let's wait for it to be
-		if ((!ipu0ch.chcr.STR || ipuRegs.ctrl.OFC || ipu0ch.qwc == 0) && ipu_cmd.pos[0] <= 3)
+		if (!IPU0Ready() && ipu_cmd.pos[0] <= 3)
 		{
 			IPUCoreStatus.WaitingOnIPUFrom = true;
 			return false;
@@ -1612,7 +1771,7 @@ __fi static bool ipuVDEC(u32 val)
 		}
 		count = 0;
 	}
-	eecount_on_last_vdec = cpuRegs.cycle;
+	eecount_on_last_vdec = ipuThread.GetCycle();
 
 	switch (ipu_cmd.pos[0])
 	{
@@ -1909,7 +2068,7 @@ __fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 	}
 }
 
-__fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
+void ipu_vq_reference(const macroblock_rgb16& rgb16, u8* indx4)
 {
 	const auto closest_index = [&](int i, int j) {
 		u8 index = 0;
@@ -1937,6 +2096,52 @@ __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
 }
 
+#if _M_SSE >= 0x501
+
+// Finds the closest CLUT entry for a whole row of pixels at once. The distances fit in 16 bits, and
+// only a strictly smaller distance replaces the current index, so ties resolve the same way.
+__ri void ipu_vq(const macroblock_rgb16& rgb16, u8* indx4)
+{
+	const __m256i mask = _mm256_set1_epi16(0x1f);
+
+	for (int i = 0; i < 16; ++i)
+	{
+		const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&rgb16.c[i][0]));
+		const __m256i r = _mm256_and_si256(pixels, mask);
+		const __m256i g = _mm256_and_si256(_mm256_srli_epi16(pixels, 5), mask);
+		const __m256i b = _mm256_and_si256(_mm256_srli_epi16(pixels, 10), mask);
+
+		__m256i index = _mm256_setzero_si256();
+		__m256i min_distance = _mm256_set1_epi16(0x7fff);
+		for (int k = 0; k < 16; ++k)
+		{
+			const __m256i dr = _mm256_sub_epi16(r, _mm256_set1_epi16(g_ipu_vqclut[k].r));
+			const __m256i dg = _mm256_sub_epi16(g, _mm256_set1_epi16(g_ipu_vqclut[k].g));
+			const __m256i db = _mm256_sub_epi16(b, _mm256_set1_epi16(g_ipu_vqclut[k].b));
+			const __m256i distance = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(dr, dr),
+				_mm256_mullo_epi16(dg, dg)), _mm256_mullo_epi16(db, db));
+
+			const __m256i closer = _mm256_cmpgt_epi16(min_distance, distance);
+			min_distance = _mm256_min_epi16(min_distance, distance);
+			index = _mm256_blendv_epi8(index, _mm256_set1_epi16(k), closer);
+		}
+
+		// Two pixels per byte, the even one in the low nibble.
+		const __m256i pairs = _mm256_and_si256(_mm256_or_si256(index, _mm256_srli_epi32(index, 12)), _mm256_set1_epi32(0xff));
+		const __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(pairs), _mm256_extracti128_si256(pairs, 1));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(&indx4[i * 8]), _mm_packus_epi16(packed, packed));
+	}
+}
+
+#else
+
+__ri void ipu_vq(const macroblock_rgb16& rgb16, u8* indx4)
+{
+	ipu_vq_reference(rgb16, indx4);
+}
+
+#endif
+
 __noinline void IPUWorker()
 {
 	pxAssert(ipuRegs.ctrl.BUSY);
@@ -2002,7 +2207,7 @@ __noinline void IPUWorker()
 	IPU_LOG("IPU Command finished");
 	ipuRegs.ctrl.BUSY = 0;
 	//ipu_cmd.current = 0xffffffff;
-	hwIntcIrq(INTC_IPU);
+	ipuThread.RaiseIntc();
 }
 
 MULTI_ISA_UNSHARED_END
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Common.h"
+#include "IPU/IPU.h"
+#include "IPU/IPU_Thread.h"
+
+#include <algorithm>
+#include <bit>
+
+IpuThread ipuThread;
+
+static thread_local bool s_on_ipu_thread = false;
+
+IpuThread::IpuThread() = default;
+
+IpuThread::~IpuThread()
+{
+	Close();
+}
+
+void IpuThread::Open()
+{
+	if (IsOpen())
+		return;
+
+	m_sema.Reset();
+	m_shutdown_flag.store(false, std::memory_order_release);
+	m_work_pending.store(false, std::memory_order_release);
+	m_worker_in_flight = false;
+	m_thread.Start([this]() { ThreadEntryPoint(); });
+}
+
+void IpuThread::Close()
+{
+	if (!IsOpen())
+		return;
+
+	WaitIPU();
+	m_shutdown_flag.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+	m_thread.Join();
+}
+
+bool IpuThread::CanRunThreaded()
+{
+	return THREAD_IPU;
+}
+
+bool IpuThread::IsOnIPUThread()
+{
+	return s_on_ipu_thread;
+}
+
+void IpuThread::ExecuteWorker()
+{
+	pxAssert(!m_worker_in_flight);
+
+	// Nothing to resume, don't bother waking the thread.
+	if (!ipuRegs.ctrl.BUSY)
+		return;
+
+	Open();
+
+	m_start_cycle = cpuRegs.cycle;
+	m_interrupt = cpuRegs.interrupt;
+	m_raised_events = 0;
+	m_raise_intc = false;
+	std::copy(std::begin(cpuRegs.eCycle), std::end(cpuRegs.eCycle), m_event_cycles.begin());
+	m_ipu0ch = ipu0ch;
+	m_ipu1ch = ipu1ch;
+
+	m_worker_in_flight = true;
+	m_work_pending.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+}
+
+void IpuThread::WaitIPU()
+{
+	if (!m_worker_in_flight || s_on_ipu_thread)
+		return;
+
+	m_sema.WaitForEmptyWithSpin();
+	m_worker_in_flight = false;
+
+	ApplyRaisedEvents();
+}
+
+void IpuThread::ApplyRaisedEvents()
+{
+	// The EE has moved on since the worker started, take that out of the delays so the events still
+	// land when they would have if the command had run inline, or as soon as possible if that's passed.
+	const s32 elapsed = static_cast<s32>(cpuRegs.cycle - m_start_cycle);
+	for (u32 bits = m_raised_events; bits != 0; bits &= bits - 1)
+	{
+		const EE_EventType n = static_cast<EE_EventType>(std::countr_zero(bits));
+		CPU_INT(n, std::max(static_cast<s32>(m_event_cycles[n]) - elapsed, 0));
+	}
+
+	if (m_raise_intc)
+		hwIntcIrq(INTC_IPU);
+}
+
+bool IpuThread::IsEventPending(EE_EventType n) const
+{
+	return ((s_on_ipu_thread ? m_interrupt : cpuRegs.interrupt) & (1u << n)) != 0;
+}
+
+u32 IpuThread::GetEventCycles(EE_EventType n) const
+{
+	return s_on_ipu_thread ? m_event_cycles[n] : cpuRegs.eCycle[n];
+}
+
+u32 IpuThread::GetCycle() const
+{
+	return s_on_ipu_thread ? m_start_cycle : cpuRegs.cycle;
+}
+
+const DMACh& IpuThread::GetIPU0Channel() const
+{
+	return s_on_ipu_thread ? m_ipu0ch : ipu0ch;
+}
+
+const DMACh& IpuThread::GetIPU1Channel() const
+{
+	return s_on_ipu_thread ? m_ipu1ch : ipu1ch;
+}
+
+void IpuThread::RaiseEvent(EE_EventType n, s32 cycles)
+{
+	if (!s_on_ipu_thread)
+	{
+		CPU_INT(n, cycles);
+		return;
+	}
+
+	m_interrupt |= 1u << n;
+	m_raised_events |= 1u << n;
+	m_event_cycles[n] = static_cast<u32>(cycles);
+}
+
+void IpuThread::RaiseIntc()
+{
+	if (!s_on_ipu_thread)
+	{
+		hwIntcIrq(INTC_IPU);
+		return;
+	}
+
+	m_raise_intc = true;
+}
+
+void IpuThread::ThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("IPU");
+	s_on_ipu_thread = true;
+
+	for (;;)
+	{
+		m_sema.WaitForWorkWithSpin();
+		if (m_shutdown_flag.load(std::memory_order_acquire))
+			break;
+
+		if (!m_work_pending.exchange(false, std::memory_order_acquire))
+			continue;
+
+		IPUProcessInterrupt();
+	}
+
+	m_sema.Kill();
+}
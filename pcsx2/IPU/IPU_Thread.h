@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "Common.h"
+
+#include "common/Threading.h"
+
+#include <array>
+#include <atomic>
+
+// Optionally runs the IPU's commands (IDEC, BDEC, VDEC, FDEC, CSC, PACK) on their own thread.
+//
+// When the IPU_PROCESS event fires, the command is resumed on the IPU thread, and the EE carries on
+// until its next event test, or until it touches the IPU (registers, FIFOs, DMAs), where it waits for
+// the IPU to stop again. Commands still only run until the FIFOs stall them, so the FIFO counters and
+// DMA handshakes behave as they do inline, the IPU just lags the EE by at most one event test interval.
+//
+// The little EE state the commands look at (the IPU DMA channels and pending events) is copied when
+// the thread is started, and the events and interrupts they raise are recorded and applied by the EE
+// once it has waited, at the next IPU access or event test. Event delays are counted from the cycle the
+// thread was started at, but any that have already passed by then fire straight away, so they can land
+// up to one event test interval later than they would have if the command had run inline.
+class IpuThread final
+{
+public:
+	IpuThread();
+	~IpuThread();
+
+	/// Returns true if the IPU thread has been started.
+	__fi bool IsOpen() const { return m_thread.Joinable(); }
+
+	/// Ensures the IPU thread is started.
+	void Open();
+
+	/// Shuts down the IPU thread if it is currently running.
+	void Close();
+
+	/// Returns true if IPU commands should be run on the IPU thread.
+	static bool CanRunThreaded();
+
+	/// Returns true if the calling thread is the IPU thread.
+	static bool IsOnIPUThread();
+
+	/// Resumes the current IPU command on the IPU thread.
+	void ExecuteWorker();
+
+	/// Waits for the IPU thread to finish, and raises any events or interrupts it requested.
+	/// Does nothing when called from the IPU thread.
+	void WaitIPU();
+
+	// EE state as seen by IPU commands. Live on the EE thread, the copy taken by ExecuteWorker() otherwise.
+	bool IsEventPending(EE_EventType n) const;
+	u32 GetEventCycles(EE_EventType n) const;
+	u32 GetCycle() const;
+	const DMACh& GetIPU0Channel() const;
+	const DMACh& GetIPU1Channel() const;
+
+	/// Schedules an EE event, or records it for WaitIPU() when called from the IPU thread.
+	void RaiseEvent(EE_EventType n, s32 cycles);
+
+	/// Raises the IPU's INTC interrupt, or records it for WaitIPU() when called from the IPU thread.
+	void RaiseIntc();
+
+private:
+	void ThreadEntryPoint();
+	void ApplyRaisedEvents();
+
+	Threading::Thread m_thread;
+	Threading::WorkSema m_sema;
+	std::atomic_bool m_shutdown_flag{false};
+	std::atomic_bool m_work_pending{false};
+
+	// Only accessed on the EE thread.
+	bool m_worker_in_flight = false;
+
+	// Written by the EE before starting the worker, and read back after waiting for it.
+	u32 m_start_cycle = 0;
+	u32 m_interrupt = 0;
+	u32 m_raised_events = 0;
+	bool m_raise_intc = false;
+	std::array<u32, 32> m_event_cycles = {};
+	DMACh m_ipu0ch = {};
+	DMACh m_ipu1ch = {};
+};
+
+extern IpuThread ipuThread;
@@ -14,11 +14,16 @@ void ipu_dither_reference(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16
 
 #if defined(_M_X86)
 void ipu_dither_sse2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte);
+#if _M_SSE >= 0x501
+void ipu_dither_avx2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte);
+#endif
 #endif
 
 __ri void ipu_dither(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte)
 {
-#if defined(_M_X86)
+#if defined(_M_X86) && _M_SSE >= 0x501
+    ipu_dither_avx2(rgb32, rgb16, dte);
+#elif defined(_M_X86)
     ipu_dither_sse2(rgb32, rgb16, dte);
 #else
     ipu_dither_reference(rgb32, rgb16, dte);
@@ -119,6 +124,60 @@ __ri void ipu_dither_sse2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16
     }
 }
 
+#if _M_SSE >= 0x501
+
+// Converts a whole row per iteration. Each pixel stays in its own 32-bit lane rather than being split
+// into channels, so the 16-bit result can be built with shifts and masks and packed down at the end.
+__ri void ipu_dither_avx2(const macroblock_rgb32 &rgb32, macroblock_rgb16 &rgb16, int dte)
+{
+    const __m256i alpha_test = _mm256_set1_epi32(0x40000000);
+    const __m256i alpha_mask = _mm256_set1_epi32(0xff000000);
+    const __m256i r_mask = _mm256_set1_epi32(0x001f);
+    const __m256i g_mask = _mm256_set1_epi32(0x03e0);
+    const __m256i b_mask = _mm256_set1_epi32(0x7c00);
+    const __m256i a_bit = _mm256_set1_epi32(0x8000);
+    // The dither pattern repeats every four pixels, so it's the same for both halves of a register.
+    const __m256i dither_add_matrix[] = {
+        _mm256_setr_epi32(0x00000000, 0x00000000, 0x00000000, 0x00010101, 0x00000000, 0x00000000, 0x00000000, 0x00010101),
+        _mm256_setr_epi32(0x00020202, 0x00000000, 0x00030303, 0x00000000, 0x00020202, 0x00000000, 0x00030303, 0x00000000),
+        _mm256_setr_epi32(0x00000000, 0x00010101, 0x00000000, 0x00000000, 0x00000000, 0x00010101, 0x00000000, 0x00000000),
+        _mm256_setr_epi32(0x00030303, 0x00000000, 0x00020202, 0x00000000, 0x00030303, 0x00000000, 0x00020202, 0x00000000),
+    };
+    const __m256i dither_sub_matrix[] = {
+        _mm256_setr_epi32(0x00040404, 0x00000000, 0x00030303, 0x00000000, 0x00040404, 0x00000000, 0x00030303, 0x00000000),
+        _mm256_setr_epi32(0x00000000, 0x00020202, 0x00000000, 0x00010101, 0x00000000, 0x00020202, 0x00000000, 0x00010101),
+        _mm256_setr_epi32(0x00030303, 0x00000000, 0x00040404, 0x00000000, 0x00030303, 0x00000000, 0x00040404, 0x00000000),
+        _mm256_setr_epi32(0x00000000, 0x00010101, 0x00000000, 0x00020202, 0x00000000, 0x00010101, 0x00000000, 0x00020202),
+    };
+    for (int i = 0; i < 16; ++i) {
+        const __m256i dither_add = dither_add_matrix[i & 3];
+        const __m256i dither_sub = dither_sub_matrix[i & 3];
+        __m256i rgba16[2];
+        for (int n = 0; n < 2; ++n) {
+            __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&rgb32.c[i][n * 8]));
+
+            // Dither and clamp
+            if (dte) {
+                rgba = _mm256_adds_epu8(rgba, dither_add);
+                rgba = _mm256_subs_epu8(rgba, dither_sub);
+            }
+
+            const __m256i r = _mm256_and_si256(_mm256_srli_epi32(rgba, 3), r_mask);
+            const __m256i g = _mm256_and_si256(_mm256_srli_epi32(rgba, 6), g_mask);
+            const __m256i b = _mm256_and_si256(_mm256_srli_epi32(rgba, 9), b_mask);
+            const __m256i a = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_and_si256(rgba, alpha_mask), alpha_test), a_bit);
+
+            rgba16[n] = _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a));
+        }
+
+        // Packing works within each 128-bit half, put the pixels back in order afterwards.
+        const __m256i packed = _mm256_packus_epi32(rgba16[0], rgba16[1]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&rgb16.c[i][0]), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+}
+
+#endif
+
 #endif
 
 MULTI_ISA_UNSHARED_END
@@ -16,6 +16,8 @@ void ipuDmaReset()
 
 bool SaveStateBase::ipuDmaFreeze()
 {
+	ipuThread.WaitIPU();
+
 	if (!FreezeTag("IPUdma"))
 		return false;
 
@@ -201,6 +203,8 @@ void IPU0dma()
 
 __fi void dmaIPU0() // fromIPU
 {
+	ipuThread.WaitIPU();
+
 	//if (dmacRegs.ctrl.STS == STS_fromIPU) DevCon.Warning("DMA Stall enabled on IPU0");
 
 	if (dmacRegs.ctrl.STS == STS_fromIPU)   // STS == fromIPU - Initial settings
@@ -231,6 +235,8 @@ __fi void dmaIPU0() // fromIPU
 
 __fi void dmaIPU1() // toIPU
 {
+	ipuThread.WaitIPU();
+
 	IPU_LOG("IPU1DMAStart QWC %x, MADR %x, CHCR %x, TADR %x", ipu1ch.qwc, ipu1ch.madr, ipu1ch.chcr._u32, ipu1ch.tadr);
 	CPU_SET_DMASTALL(DMAC_TO_IPU, false);
 
@@ -268,11 +274,16 @@ __fi void dmaIPU1() // toIPU
 
 void ipuCMDProcess()
 {
-	IPUProcessInterrupt();
+	if (IpuThread::CanRunThreaded())
+		ipuThread.ExecuteWorker();
+	else
+		IPUProcessInterrupt();
 }
 
 void ipu0Interrupt()
 {
+	ipuThread.WaitIPU();
+
 	IPU_LOG("ipu0Interrupt: %x", cpuRegs.cycle);
 
 	if(ipu0ch.qwc > 0)
@@ -289,6 +300,8 @@ void ipu0Interrupt()
 
 __fi void ipu1Interrupt()
 {
+	ipuThread.WaitIPU();
+
 	IPU_LOG("ipu1Interrupt %x:", cpuRegs.cycle);
 
 	if(!IPU1Status.DMAFinished || IPU1Status.InProgress)  //Sanity Check
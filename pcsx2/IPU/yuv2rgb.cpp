@@ -45,9 +45,6 @@ void yuv2rgb_reference(void)
 #if defined(_M_X86)
 
 // Suikoden Tactics FMV speed results: Reference - ~72fps, SSE2 - ~120fps
-// An AVX2 version is only slightly faster than an SSE2 version (+2-3fps)
-// (or I'm a poor optimiser), though it might be worth attempting again
-// once we've ported to 64 bits (the extra registers should help).
 __ri void yuv2rgb_sse2()
 {
 	const __m128i c_bias = _mm_set1_epi8(s8(IPU_C_BIAS));
@@ -136,6 +133,82 @@ __ri void yuv2rgb_sse2()
 	}
 }
 
+#if _M_SSE >= 0x501
+
+// Same as the SSE2 version, but both luma rows sharing a chroma row are converted together, one per
+// 128-bit half. Every step works within the halves, so each produces exactly what the SSE2 one does.
+__ri void yuv2rgb_avx2()
+{
+	const __m256i c_bias = _mm256_set1_epi8(s8(IPU_C_BIAS));
+	const __m256i y_bias = _mm256_set1_epi8(IPU_Y_BIAS);
+	const __m256i y_mask = _mm256_set1_epi16(s16(0xFF00));
+	const __m256i round_1bit = _mm256_set1_epi16(0x0001);
+
+	const __m256i y_coefficient = _mm256_set1_epi16(s16(IPU_Y_COEFF << 2));
+	const __m256i gcr_coefficient = _mm256_set1_epi16(s16(u16(IPU_GCR_COEFF) << 2));
+	const __m256i gcb_coefficient = _mm256_set1_epi16(s16(u16(IPU_GCB_COEFF) << 2));
+	const __m256i rcr_coefficient = _mm256_set1_epi16(s16(IPU_RCR_COEFF << 2));
+	const __m256i bcb_coefficient = _mm256_set1_epi16(s16(IPU_BCB_COEFF << 2));
+
+	// Alpha set to 0x80 here. The threshold stuff is done later.
+	const __m256i& alpha = c_bias;
+
+	for (int n = 0; n < 8; ++n) {
+		__m256i cb = _mm256_broadcastsi128_si256(_mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cb[n][0])));
+		__m256i cr = _mm256_broadcastsi128_si256(_mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cr[n][0])));
+
+		// (Cb - 128) << 8, (Cr - 128) << 8
+		cb = _mm256_xor_si256(cb, c_bias);
+		cr = _mm256_xor_si256(cr, c_bias);
+		cb = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cb);
+		cr = _mm256_unpacklo_epi8(_mm256_setzero_si256(), cr);
+
+		const __m256i rc = _mm256_mulhi_epi16(cr, rcr_coefficient);
+		const __m256i gc = _mm256_adds_epi16(_mm256_mulhi_epi16(cr, gcr_coefficient), _mm256_mulhi_epi16(cb, gcb_coefficient));
+		const __m256i bc = _mm256_mulhi_epi16(cb, bcb_coefficient);
+
+		__m256i y = _mm256_loadu_si256(reinterpret_cast<__m256i*>(&decoder.mb8.Y[n * 2][0]));
+		y = _mm256_subs_epu8(y, y_bias);
+		__m256i y_even = _mm256_mulhi_epu16(_mm256_slli_epi16(y, 8), y_coefficient);
+		__m256i y_odd = _mm256_mulhi_epu16(_mm256_and_si256(y, y_mask), y_coefficient);
+
+		// round
+		const __m256i r_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(rc, y_even), round_1bit), 1);
+		const __m256i r_odd = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(rc, y_odd), round_1bit), 1);
+		const __m256i g_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(gc, y_even), round_1bit), 1);
+		const __m256i g_odd = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(gc, y_odd), round_1bit), 1);
+		const __m256i b_even = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(bc, y_even), round_1bit), 1);
+		const __m256i b_odd = _mm256_srai_epi16(_mm256_add_epi16(_mm256_adds_epi16(bc, y_odd), round_1bit), 1);
+
+		// combine even and odd bytes in original order
+		__m256i r = _mm256_packus_epi16(r_even, r_odd);
+		__m256i g = _mm256_packus_epi16(g_even, g_odd);
+		__m256i b = _mm256_packus_epi16(b_even, b_odd);
+
+		r = _mm256_unpacklo_epi8(r, _mm256_shuffle_epi32(r, _MM_SHUFFLE(3, 2, 3, 2)));
+		g = _mm256_unpacklo_epi8(g, _mm256_shuffle_epi32(g, _MM_SHUFFLE(3, 2, 3, 2)));
+		b = _mm256_unpacklo_epi8(b, _mm256_shuffle_epi32(b, _MM_SHUFFLE(3, 2, 3, 2)));
+
+		const __m256i rg_l = _mm256_unpacklo_epi8(r, g);
+		const __m256i ba_l = _mm256_unpacklo_epi8(b, alpha);
+		const __m256i rgba_ll = _mm256_unpacklo_epi16(rg_l, ba_l);
+		const __m256i rgba_lh = _mm256_unpackhi_epi16(rg_l, ba_l);
+
+		const __m256i rg_h = _mm256_unpackhi_epi8(r, g);
+		const __m256i ba_h = _mm256_unpackhi_epi8(b, alpha);
+		const __m256i rgba_hl = _mm256_unpacklo_epi16(rg_h, ba_h);
+		const __m256i rgba_hh = _mm256_unpackhi_epi16(rg_h, ba_h);
+
+		// The low halves hold the first row, and the high halves the second.
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2][0]), _mm256_permute2x128_si256(rgba_ll, rgba_lh, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2][8]), _mm256_permute2x128_si256(rgba_hl, rgba_hh, 0x20));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2 + 1][0]), _mm256_permute2x128_si256(rgba_ll, rgba_lh, 0x31));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoder.rgb32.c[n * 2 + 1][8]), _mm256_permute2x128_si256(rgba_hl, rgba_hh, 0x31));
+	}
+}
+
+#endif
+
 #elif defined(_M_ARM64)
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -3365,6 +3365,10 @@ void FullscreenUI::DrawEmulationSettingsPage()
 			"EmuCore/Speedhacks", "fastCDVD", false);
 	}
 
+	DrawToggleSetting(bsi, FSUI_CSTR("Enable Adaptive Fast Loading"),
+		FSUI_CSTR("Speeds up disc access while the game is loading, but not while it is streaming audio or video."),
+		"EmuCore/Speedhacks", "fastLoad", false);
+
 	DrawToggleSetting(bsi, FSUI_CSTR("Enable CDVD Precaching"), FSUI_CSTR("Loads the disc image into RAM before starting the virtual machine."),
 		"EmuCore", "CdvdPrecache", false);
 
@@ -4036,6 +4040,12 @@ void FullscreenUI::DrawAudioSettingsPage()
 	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_STOPWATCH, "Minimal Output Latency"),
 		FSUI_CSTR("When enabled, the minimum supported output latency will be used for the host API."),
 		"SPU2/Output", "OutputLatencyMinimal", AudioStreamParameters::DEFAULT_OUTPUT_LATENCY_MINIMAL);
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_LAYER_GROUP, "Block Mixing"),
+		FSUI_CSTR("Mixes audio several samples at a time when no interrupts or DMAs depend on it. Does not change the output."),
+		"SPU2/Output", "BlockMixing", true);
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_MICROCHIP, "Threaded Mixing"),
+		FSUI_CSTR("Mixes blocks of audio on a separate thread. Can improve performance on CPUs with spare cores."),
+		"SPU2/Output", "ThreadedMixing", false, GetEffectiveBoolSetting(bsi, "SPU2/Output", "BlockMixing", true));
 
 	EndMenuButtons();
 }
@@ -4756,6 +4766,9 @@ void FullscreenUI::DrawAdvancedSettingsPage()
 			"EnableEE", true);
 		DrawToggleSetting(bsi, FSUI_CSTR("Enable EE Cache"), FSUI_CSTR("Enables simulation of the EE's cache. Slow."),
 			"EmuCore/CPU/Recompiler", "EnableEECache", false);
+		DrawToggleSetting(bsi, FSUI_CSTR("Enable Cached Interpreter"),
+			FSUI_CSTR("Decodes blocks of EE code once and reuses them when the recompiler is disabled."), "EmuCore/CPU/Recompiler",
+			"EnableEECachedInterpreter", true);
 		DrawToggleSetting(bsi, FSUI_CSTR("Enable INTC Spin Detection"),
 			FSUI_CSTR("Huge speedup for some games, with almost no compatibility side effects."), "EmuCore/Speedhacks", "IntcStat", true);
 		DrawToggleSetting(bsi, FSUI_CSTR("Enable Wait Loop Detection"),
@@ -6977,6 +6990,8 @@ TRANSLATE_NOOP("FullscreenUI", "Enable Host Filesystem");
 TRANSLATE_NOOP("FullscreenUI", "Enables access to files from the host: namespace in the virtual machine.");
 TRANSLATE_NOOP("FullscreenUI", "Enable Fast CDVD");
 TRANSLATE_NOOP("FullscreenUI", "Fast disc access, less loading times. Not recommended.");
+TRANSLATE_NOOP("FullscreenUI", "Enable Adaptive Fast Loading");
+TRANSLATE_NOOP("FullscreenUI", "Speeds up disc access while the game is loading, but not while it is streaming audio or video.");
 TRANSLATE_NOOP("FullscreenUI", "Enable CDVD Precaching");
 TRANSLATE_NOOP("FullscreenUI", "Loads the disc image into RAM before starting the virtual machine.");
 TRANSLATE_NOOP("FullscreenUI", "Frame Pacing/Latency Control");
@@ -50,6 +50,7 @@
 namespace ImGuiManager
 {
 	static void FormatProcessorStat(SmallStringBase& text, double usage, double time);
+	static void FormatRingStat(SmallStringBase& text, const PerformanceMetrics::RingStats& stats);
 	static void DrawPerformanceOverlay(float& position_y, float scale, float margin, float spacing);
 	static void DrawSettingsOverlay(float scale, float margin, float spacing);
 	static void DrawInputsOverlay(float scale, float margin, float spacing);
@@ -94,6 +95,18 @@ __ri void ImGuiManager::FormatProcessorStat(SmallStringBase& text, double usage,
 		text.append_format("{:.1f}% ({:.2f}ms)", usage, time);
 }
 
+__ri void ImGuiManager::FormatRingStat(SmallStringBase& text, const PerformanceMetrics::RingStats& stats)
+{
+	// Peak ring occupancy, plus how often the EE had to wait for it to drain.
+	if (stats.size == 0)
+		return;
+
+	text.append_format(" [ring {:.0f}%", (static_cast<double>(stats.high_water) * 100.0) / static_cast<double>(stats.size));
+	if (stats.stalls > 0)
+		text.append_format(", {} stalls ({:.2f}ms)", stats.stalls, stats.stall_time);
+	text.append("]");
+}
+
 __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, float margin, float spacing)
 {
 	const float shadow_offset = std::ceil(scale);
@@ -243,6 +256,7 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 
 			text = "GS: ";
 			FormatProcessorStat(text, PerformanceMetrics::GetGSThreadUsage(), PerformanceMetrics::GetGSThreadAverageTime());
+			FormatRingStat(text, PerformanceMetrics::GetGSRingStats());
 			DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 			const u32 gs_sw_threads = PerformanceMetrics::GetGSSWThreadCount();
@@ -258,6 +272,7 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 			{
 				text = "VU: ";
 				FormatProcessorStat(text, PerformanceMetrics::GetVUThreadUsage(), PerformanceMetrics::GetVUThreadAverageTime());
+				FormatRingStat(text, PerformanceMetrics::GetVURingStats());
 				DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
 
@@ -265,6 +280,8 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 			{
 				text = "CAP: ";
 				FormatProcessorStat(text, PerformanceMetrics::GetCaptureThreadUsage(), PerformanceMetrics::GetCaptureThreadAverageTime());
+				if (const u32 dropped_frames = PerformanceMetrics::GetCaptureDroppedFrames(); dropped_frames > 0)
+					text.append_format(" [{} dropped]", dropped_frames);
 				DRAW_LINE(fixed_font, text.c_str(), IM_COL32(255, 255, 255, 255));
 			}
 		}
@@ -387,6 +404,8 @@ __ri void ImGuiManager::DrawSettingsOverlay(float scale, float margin, float spa
 		APPEND("CS={} ", EmuConfig.Speedhacks.EECycleSkip);
 	if (EmuConfig.Speedhacks.fastCDVD)
 		APPEND("FCDVD ");
+	if (EmuConfig.Speedhacks.fastLoad)
+		APPEND("FLOAD ");
 	if (EmuConfig.Speedhacks.vu1Instant)
 		APPEND("IVU ");
 	if (EmuConfig.Speedhacks.vuThread)
@@ -11,6 +11,9 @@
 #include "common/FastJmp.h"
 
 #include <float.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 using namespace R5900;		// for OPCODE and OpcodeImpl
 
@@ -25,6 +28,18 @@ static u32 intLastBranchTo;
 
 static void intEventTest();
 
+// A predecoded instruction for the cached interpreter.
+struct CachedInstruction
+{
+	void (*interpret)();
+	u32 code;
+	u8 cycles;
+	bool has_delay_slot;
+};
+
+// Set while a branch from a cached block runs, so its delay slot doesn't need decoding again.
+static const CachedInstruction* s_delay_slot = nullptr;
+
 void intUpdateCPUCycles()
 {
 	const bool lowcycles = (cpuBlockCycles <= 40);
@@ -167,6 +182,15 @@ static void execI()
 	// and it expects the PC counter to be pre-incremented
 	cpuRegs.pc += 4;
 
+	if (s_delay_slot)
+	{
+		const CachedInstruction* inst = std::exchange(s_delay_slot, nullptr);
+		cpuRegs.code = inst->code;
+		cpuBlockCycles += inst->cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
+		inst->interpret();
+		return;
+	}
+
 	// interprete instruction
 	cpuRegs.code = memRead32( pc );
 
@@ -532,6 +556,244 @@ void JALR()
 } } }		// end namespace R5900::Interpreter::OpcodeImpl
 
 
+// --------------------------------------------------------------------------------------
+//  Cached interpreter
+// --------------------------------------------------------------------------------------
+// Decoding an instruction means reading it through the vtlb and walking the opcode tables, which
+// costs more than executing most of them. So blocks of code are decoded once into their handlers
+// and reused until they're written to. Pages holding cached code are write protected the same way
+// as for the recompiler, so writes to them come back through intClear(). Blocks in pages under
+// manual protection check their code each time they're entered instead.
+
+struct CachedBlock
+{
+	const u32* host_code;
+	const vtlb_ProtectionMode* page_mode;
+	bool verify;
+	bool uncached;
+	std::vector<CachedInstruction> insts;
+};
+
+static std::unordered_map<u32, CachedBlock> s_cached_blocks;
+static std::unordered_map<uptr, std::vector<u32>> s_cached_pages; // host page -> start pcs
+static bool s_cached_block_cleared = false;
+
+static const u32* intGetCodePointer(u32 pc)
+{
+	const vtlb_private::VTLBVirtual vmv = vtlb_private::vtlbdata.vmap[pc >> vtlb_private::VTLB_PAGE_BITS];
+	if (vmv.isHandler(pc))
+		return nullptr;
+
+	return reinterpret_cast<const u32*>(vmv.assumePtr(pc));
+}
+
+static __fi uptr intGetHostPage(const u32* ptr)
+{
+	return reinterpret_cast<uptr>(ptr) & ~static_cast<uptr>(vtlb_private::VTLB_PAGE_MASK);
+}
+
+static void intRemoveFromPage(const u32* host_code, u32 pc)
+{
+	const auto it = s_cached_pages.find(intGetHostPage(host_code));
+	if (it == s_cached_pages.end())
+		return;
+
+	std::vector<u32>& pcs = it->second;
+	for (size_t i = 0; i < pcs.size(); i++)
+	{
+		if (pcs[i] == pc)
+		{
+			pcs[i] = pcs.back();
+			pcs.pop_back();
+			break;
+		}
+	}
+
+	if (pcs.empty())
+		s_cached_pages.erase(it);
+}
+
+static void intProtectBlock(CachedBlock& block)
+{
+	const uptr offset = reinterpret_cast<const u8*>(block.host_code) - eeMem->Main;
+	if (offset >= Ps2MemSize::ExposedRam)
+		return;
+
+	const u32 paddr = static_cast<u32>(offset);
+	const u32 size = static_cast<u32>(block.insts.size() * 4);
+
+	// The kernel keeps thread contexts in these pages, so protecting them would just fault constantly.
+	const u32 page = paddr >> 12;
+	const vtlb_ProtectionMode mode = (page == 0x81 || page == 0x1) ? ProtMode_Manual : mmap_GetRamPageInfo(paddr);
+	if (mode == ProtMode_NotRequired)
+		return;
+
+	mmap_MarkRamPageCode(paddr, size);
+
+	if (mode == ProtMode_Manual)
+	{
+		block.verify = true;
+	}
+	else
+	{
+		mmap_MarkCountedRamPage(paddr);
+		block.page_mode = mmap_GetRamPageModePtr(paddr);
+	}
+}
+
+static CachedBlock& intCompileBlock(u32 pc, const u32* host_code)
+{
+	CachedBlock& block = s_cached_blocks[pc];
+	if (block.host_code)
+		intRemoveFromPage(block.host_code, pc);
+
+	block.host_code = host_code;
+	block.page_mode = nullptr;
+	block.verify = false;
+	block.uncached = false;
+	block.insts.clear();
+	s_cached_pages[intGetHostPage(host_code)].push_back(pc);
+
+	bool in_delay_slot = false;
+	for (u32 i = 0;; i++)
+	{
+		const u32 inst_pc = pc + i * 4;
+#ifdef PCSX2_DEVBUILD
+		// Breakpoints are checked for each instruction in execI(), so leave those to it.
+		if (isBreakpointNeeded(inst_pc) || isMemcheckNeeded(inst_pc))
+		{
+			block.uncached = true;
+			break;
+		}
+#endif
+
+		const u32 code = host_code[i];
+		const OPCODE& opcode = GetInstruction(code);
+		const u32 branch_type = opcode.flags & BRANCHTYPE_MASK;
+		const bool has_delay_slot = (opcode.flags & IS_BRANCH) && branch_type != BRANCHTYPE_SYSCALL && branch_type != BRANCHTYPE_ERET;
+		block.insts.push_back({opcode.interpret, code, opcode.cycles, has_delay_slot});
+
+		// Blocks never cross pages, so each one is covered by a single protection/translation.
+		if (in_delay_slot || ((inst_pc + 4) & vtlb_private::VTLB_PAGE_MASK) == 0 || ((opcode.flags & IS_BRANCH) && !has_delay_slot))
+			break;
+
+		in_delay_slot = has_delay_slot;
+	}
+
+	if (block.uncached)
+		block.insts.clear();
+	else
+		intProtectBlock(block);
+
+	return block;
+}
+
+static __fi bool intIsBlockValid(const CachedBlock& block, const u32* host_code)
+{
+	if (block.host_code != host_code)
+		return false;
+	if (!block.verify)
+		return true;
+
+	for (size_t i = 0; i < block.insts.size(); i++)
+	{
+		if (block.insts[i].code != host_code[i])
+			return false;
+	}
+
+	return true;
+}
+
+static void intExecuteCachedBlock()
+{
+	const u32 pc = cpuRegs.pc;
+	const u32* host_code = intGetCodePointer(pc);
+	if (!host_code)
+	{
+		execI();
+		return;
+	}
+
+	auto it = s_cached_blocks.find(pc);
+
+	// Writes which miss all the code in a page unprotect it without clearing the blocks, so check the code first.
+	if (it != s_cached_blocks.end() && it->second.page_mode && *it->second.page_mode == ProtMode_Pending)
+	{
+		mmap_VerifyRamPage(static_cast<u32>(reinterpret_cast<const u8*>(it->second.host_code) - eeMem->Main));
+		it = s_cached_blocks.find(pc);
+	}
+
+	const CachedBlock& block = (it != s_cached_blocks.end() && intIsBlockValid(it->second, host_code)) ?
+								   it->second :
+								   intCompileBlock(pc, host_code);
+	if (block.uncached)
+	{
+		execI();
+		return;
+	}
+
+	s_cached_block_cleared = false;
+
+	const CachedInstruction* inst = block.insts.data();
+	const CachedInstruction* const end = inst + block.insts.size();
+	u32 inst_pc = pc;
+	do
+	{
+		inst_pc += 4;
+		cpuRegs.pc = inst_pc;
+		cpuRegs.code = inst->code;
+		cpuBlockCycles += inst->cycles * (2 - ((cpuRegs.CP0.n.Config >> 18) & 0x1));
+
+		if (inst->has_delay_slot && (inst + 1) != end)
+			s_delay_slot = inst + 1;
+
+		inst->interpret();
+		s_delay_slot = nullptr;
+
+		// Branches, exceptions and writes to the block all leave it.
+		if (s_cached_block_cleared || cpuRegs.pc != inst_pc)
+			break;
+	} while (++inst != end);
+}
+
+static void intClearHostRange(const u32* host_start, u32 size)
+{
+	const uptr start = reinterpret_cast<uptr>(host_start);
+	const uptr end = start + size;
+	const auto it = s_cached_pages.find(intGetHostPage(host_start));
+	if (it == s_cached_pages.end())
+		return;
+
+	std::vector<u32>& pcs = it->second;
+	for (size_t i = 0; i < pcs.size();)
+	{
+		const auto bit = s_cached_blocks.find(pcs[i]);
+		const uptr block_start = reinterpret_cast<uptr>(bit->second.host_code);
+		const uptr block_end = block_start + bit->second.insts.size() * 4;
+		if (block_start < end && start < std::max(block_end, block_start + 4))
+		{
+			s_cached_blocks.erase(bit);
+			pcs[i] = pcs.back();
+			pcs.pop_back();
+			s_cached_block_cleared = true;
+			continue;
+		}
+
+		i++;
+	}
+
+	if (pcs.empty())
+		s_cached_pages.erase(it);
+}
+
+static void intClearCachedBlocks()
+{
+	s_cached_blocks.clear();
+	s_cached_pages.clear();
+	s_cached_block_cleared = true;
+	s_delay_slot = nullptr;
+}
+
 // --------------------------------------------------------------------------------------
 //  R5900cpu/intCpu interface (implementations)
 // --------------------------------------------------------------------------------------
@@ -545,6 +807,9 @@ static void intReset()
 {
 	cpuRegs.branch = 0;
 	branch2 = 0;
+
+	intClearCachedBlocks();
+	mmap_ResetBlockTracking();
 }
 
 static void intEventTest()
@@ -637,6 +902,11 @@ static void intExecute()
 				}
 			}
 		}
+		else if (EmuConfig.Cpu.Recompiler.EnableEECachedInterpreter)
+		{
+			while (true)
+				intExecuteCachedBlock();
+		}
 		else
 		{
 			while (true)
@@ -652,9 +922,26 @@ static void intStep()
 
 static void intClear(u32 Addr, u32 Size)
 {
+	if (s_cached_blocks.empty())
+		return;
+
+	// Page protection passes physical addresses, and TLB changes pass virtual ones, so clear whatever either maps to.
+	const u32 end = Addr + Size * 4;
+	for (u32 addr = Addr; addr < end;)
+	{
+		const u32 page_end = std::min((addr & ~vtlb_private::VTLB_PAGE_MASK) + vtlb_private::VTLB_PAGE_SIZE, end);
+		if (const u32* phys = static_cast<const u32*>(PSM(addr)))
+			intClearHostRange(phys, page_end - addr);
+		if (const u32* virt = intGetCodePointer(addr); virt && !s_cached_blocks.empty())
+			intClearHostRange(virt, page_end - addr);
+
+		addr = page_end;
+	}
 }
 
-static void intShutdown() {
+static void intShutdown()
+{
+	intClearCachedBlocks();
 }
 
 R5900cpu intCpu =
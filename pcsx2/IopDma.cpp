@@ -7,6 +7,7 @@
 #include "IopCounters.h"
 #include "IopHw.h"
 #include "IopDma.h"
+#include "MTIOP.h"
 #include "SIO/Sio2.h"
 
 #include "Sif.h"
@@ -196,6 +197,9 @@ void psxDma9(u32 madr, u32 bcr, u32 chcr)
 {
 	SIF_LOG("IOP: dmaSIF0 chcr = %lx, madr = %lx, bcr = %lx, tadr = %lx", chcr, madr, bcr, HW_DMA9_TADR);
 
+	// The SIF channels are shared with the EE's DMAC.
+	iopThread.WaitForEE();
+
 	sif0.iop.busy = true;
 	sif0.iop.end = false;
 
@@ -206,6 +210,9 @@ void psxDma10(u32 madr, u32 bcr, u32 chcr)
 {
 	SIF_LOG("IOP: dmaSIF1 chcr = %lx, madr = %lx, bcr = %lx", chcr, madr, bcr);
 
+	// The SIF channels are shared with the EE's DMAC.
+	iopThread.WaitForEE();
+
 	sif1.iop.busy = true;
 	sif1.iop.end = false;
 
@@ -10,10 +10,14 @@
 #include "VMManager.h"
 
 #include "common/FPControl.h"
+#include "common/HostSys.h"
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
-#include "common/WrappedMemCopy.h"
+#include "common/Timer.h"
 
+#include "fmt/format.h"
+
+#include <array>
 #include <list>
 #include <mutex>
 #include <thread>
@@ -32,14 +36,20 @@
 
 namespace MTGS
 {
+	// The ring is mapped twice back to back, so packets which wrap around the end of it can be written
+	// and read as one contiguous block. Only (re)allocated on hardware resets while the GS is closed.
+	static MirroredMemory s_RingMemory;
+	static uint s_RingBufferSize = 0; // in simd128's
+	static uint s_RingBufferMask = 0; // wraps indices from end to start (the wrapping is what makes it a ringbuffer, yo!)
+
 	struct BufferedData
 	{
-		u128 m_Ring[RingBufferSize];
-		u8 Regs[Ps2MemSize::GSregs];
+		u128* m_Ring;
+		alignas(16) u8 Regs[Ps2MemSize::GSregs];
 
 		u128& operator[](uint idx)
 		{
-			pxAssert(idx < RingBufferSize);
+			pxAssert(idx < s_RingBufferSize);
 			return m_Ring[idx];
 		}
 	};
@@ -47,6 +57,7 @@ namespace MTGS
 	static void ThreadEntryPoint();
 	static void MainLoop();
 
+	static void AllocateRingBuffer();
 	static void GenericStall(uint size);
 
 	static void PrepDataPacket(Command cmd, u32 size);
@@ -57,6 +68,10 @@ namespace MTGS
 	static void SendSimpleGSPacket(Command type, u32 offset, u32 size, GIF_PATH path);
 	static void SendPointerPacket(Command type, u32 data0, void* data1);
 	static void _FinishSimplePacket();
+
+	static bool MergeGSPacket(u32 offset, u32 size, GIF_PATH path);
+	static void FlushPendingGSPacket();
+	static void LogProducerStats();
 	static u8* GetDataPacketPtr();
 
 	static void SetEvent();
@@ -89,6 +104,37 @@ namespace MTGS
 	// has more than one command in it when the thread is kicked.
 	static int s_CopyDataTally;
 
+	// GS packets which directly follow the previous one in the same path buffer are merged into its ring
+	// command, so the GS thread gets one larger transfer instead of lots of tiny ones. The command at
+	// s_WritePos is held back (not visible to the GS thread) while it can still grow, and is published as
+	// soon as anything else is queued, the EE waits on the GS, or it reaches the size limit below.
+	// Only touched by the EE thread.
+	static constexpr u32 GSPacketMergeLimit = 0x10000; // in bytes
+	static bool s_GSPacketPending = false;
+
+	// Producer-side statistics, reported when the GS thread is closed.
+	struct ProducerStats
+	{
+		u64 gs_packets;
+		u64 merged_gs_packets;
+		u64 stalls;
+		Common::Timer::Value stall_ticks;
+
+		// How full the ring was each time space was reserved in it, in eighths.
+		std::array<u64, 8> occupancy;
+	};
+	static ProducerStats s_ProducerStats = {};
+
+	// Same as above, but only covering the period since the performance metrics last collected them,
+	// which happens on the GS thread.
+	struct IntervalStats
+	{
+		std::atomic<u64> stalls{0};
+		std::atomic<Common::Timer::Value> stall_ticks{0};
+		std::atomic<uint> high_water{0};
+	};
+	static IntervalStats s_IntervalStats;
+
 #ifdef RINGBUF_DEBUG_STACK
 	static std::mutex s_lock_Stack;
 	static std::list<uint> ringposStack;
@@ -200,8 +246,14 @@ void MTGS::ResetGS(bool hardware_reset)
 	//  * Signal a reset.
 	//  * clear the path and byRegs structs (used by GIFtagDummy)
 
+	FlushPendingGSPacket();
+
 	if (hardware_reset)
 	{
+		// The GS thread isn't reading the ring while it's closed, so this is where it gets resized on VM start.
+		if (!IsOpen())
+			AllocateRingBuffer();
+
 		s_ReadPos = s_WritePos.load();
 		s_QueuedFrameCount = 0;
 		s_VsyncSignalListener = 0;
@@ -214,6 +266,34 @@ void MTGS::ResetGS(bool hardware_reset)
 		SetEvent();
 }
 
+void MTGS::AllocateRingBuffer()
+{
+	const uint size = static_cast<uint>((static_cast<u64>(EmuConfig.GS.MTGSRingSize) * _1mb) / sizeof(u128));
+	if (s_RingMemory.IsValid() && size == s_RingBufferSize)
+		return;
+
+	if (!s_RingMemory.Allocate("pcsx2_mtgs", size * sizeof(u128)))
+		pxFailRel("Failed to allocate MTGS ring buffer");
+
+	DevCon.WriteLn("MTGS: Allocated %u MB ring buffer", EmuConfig.GS.MTGSRingSize);
+	RingBuffer.m_Ring = reinterpret_cast<u128*>(s_RingMemory.GetPointer());
+	s_RingBufferSize = size;
+	s_RingBufferMask = size - 1;
+	s_ReadPos.store(0, std::memory_order_relaxed);
+	s_WritePos.store(0, std::memory_order_relaxed);
+}
+
+PerformanceMetrics::RingStats MTGS::GetAndResetRingStats()
+{
+	PerformanceMetrics::RingStats stats;
+	stats.stalls = s_IntervalStats.stalls.exchange(0, std::memory_order_relaxed);
+	stats.stall_time = static_cast<float>(
+		Common::Timer::ConvertValueToMilliseconds(s_IntervalStats.stall_ticks.exchange(0, std::memory_order_relaxed)));
+	stats.high_water = s_IntervalStats.high_water.exchange(0, std::memory_order_relaxed) * sizeof(u128);
+	stats.size = s_RingBufferSize * sizeof(u128);
+	return stats;
+}
+
 int MTGS::GetCurrentVsyncQueueSize()
 {
 	return s_QueuedFrameCount.load(std::memory_order_acquire);
@@ -240,14 +320,14 @@ void MTGS::PostVsyncStart(bool registers_written)
 
 	uint packsize = sizeof(RingCmdPacket_Vsync) / 16;
 	PrepDataPacket(Command::VSync, packsize);
-	MemCopy_WrappedDest((u128*)PS2MEM_GS, RingBuffer.m_Ring, s_packet_writepos, RingBufferSize, 0xf);
 
-	u32* remainder = (u32*)GetDataPacketPtr();
-	remainder[0] = GSCSRr;
-	remainder[1] = GSIMR._u32;
-	(GSRegSIGBLID&)remainder[2] = GSSIGLBLID;
-	remainder[4] = static_cast<u32>(registers_written);
-	s_packet_writepos = (s_packet_writepos + 2) & RingBufferMask;
+	RingCmdPacket_Vsync& packet = *(RingCmdPacket_Vsync*)GetDataPacketPtr();
+	std::memcpy(packet.regset1, PS2MEM_GS, sizeof(packet.regset1));
+	packet.csr = GSCSRr;
+	packet.imr = GSIMR._u32;
+	packet.siglblid = GSSIGLBLID;
+	packet.registers_written = static_cast<u32>(registers_written);
+	s_packet_writepos = (s_packet_writepos + packsize) & s_RingBufferMask;
 
 	SendDataPacket();
 
@@ -343,7 +423,7 @@ void MTGS::MainLoop()
 		{
 			const unsigned int local_ReadPos = s_ReadPos.load(std::memory_order_relaxed);
 
-			pxAssert(local_ReadPos < RingBufferSize);
+			pxAssert(local_ReadPos < s_RingBufferSize);
 
 			const PacketTagType& tag = (PacketTagType&)RingBuffer[local_ReadPos];
 			u32 ringposinc = 1;
@@ -368,24 +448,13 @@ void MTGS::MainLoop()
 #if COPY_GS_PACKET_TO_MTGS == 1
 				case Command::GIFPath1:
 				{
-					uint datapos = (local_ReadPos + 1) & RingBufferMask;
+					uint datapos = (local_ReadPos + 1) & s_RingBufferMask;
 					const int qsize = tag.data[0];
 					const u128* data = &RingBuffer[datapos];
 
 					MTGS_LOG("(MTGS Packet Read) ringtype=P1, qwc=%u", qsize);
 
-					uint endpos = datapos + qsize;
-					if (endpos >= RingBufferSize)
-					{
-						uint firstcopylen = RingBufferSize - datapos;
-						GSgifTransfer((u8*)data, firstcopylen);
-						datapos = endpos & RingBufferMask;
-						GSgifTransfer((u8*)RingBuffer.m_Ring, datapos);
-					}
-					else
-					{
-						GSgifTransfer((u8*)data, qsize);
-					}
+					GSgifTransfer((u8*)data, qsize);
 
 					ringposinc += qsize;
 				}
@@ -393,24 +462,13 @@ void MTGS::MainLoop()
 
 				case Command::GIFPath2:
 				{
-					uint datapos = (local_ReadPos + 1) & RingBufferMask;
+					uint datapos = (local_ReadPos + 1) & s_RingBufferMask;
 					const int qsize = tag.data[0];
 					const u128* data = &RingBuffer[datapos];
 
 					MTGS_LOG("(MTGS Packet Read) ringtype=P2, qwc=%u", qsize);
 
-					uint endpos = datapos + qsize;
-					if (endpos >= RingBufferSize)
-					{
-						uint firstcopylen = RingBufferSize - datapos;
-						GSgifTransfer2((u32*)data, firstcopylen);
-						datapos = endpos & RingBufferMask;
-						GSgifTransfer2((u32*)RingBuffer.m_Ring, datapos);
-					}
-					else
-					{
-						GSgifTransfer2((u32*)data, qsize);
-					}
+					GSgifTransfer2((u32*)data, qsize);
 
 					ringposinc += qsize;
 				}
@@ -418,24 +476,13 @@ void MTGS::MainLoop()
 
 				case Command::GIFPath3:
 				{
-					uint datapos = (local_ReadPos + 1) & RingBufferMask;
+					uint datapos = (local_ReadPos + 1) & s_RingBufferMask;
 					const int qsize = tag.data[0];
 					const u128* data = &RingBuffer[datapos];
 
 					MTGS_LOG("(MTGS Packet Read) ringtype=P3, qwc=%u", qsize);
 
-					uint endpos = datapos + qsize;
-					if (endpos >= RingBufferSize)
-					{
-						uint firstcopylen = RingBufferSize - datapos;
-						GSgifTransfer3((u32*)data, firstcopylen);
-						datapos = endpos & RingBufferMask;
-						GSgifTransfer3((u32*)RingBuffer.m_Ring, datapos);
-					}
-					else
-					{
-						GSgifTransfer3((u32*)data, qsize);
-					}
+					GSgifTransfer3((u32*)data, qsize);
 
 					ringposinc += qsize;
 				}
@@ -483,19 +530,15 @@ void MTGS::MainLoop()
 							MTGS_LOG("(MTGS Packet Read) ringtype=Vsync, field=%u, skip=%s", !!(((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, tag.data[1] ? "true" : "false");
 
 							// Mail in the important GS registers.
-							// This seemingly obtuse system is needed in order to handle cases where the vsync data wraps
-							// around the edge of the ringbuffer.  If not for that I'd just use a struct. >_<
-
-							uint datapos = (local_ReadPos + 1) & RingBufferMask;
-							MemCopy_WrappedSrc(RingBuffer.m_Ring, datapos, RingBufferSize, (u128*)RingBuffer.Regs, 0xf);
-
-							u32* remainder = (u32*)&RingBuffer[datapos];
-							((u32&)RingBuffer.Regs[0x1000]) = remainder[0];
-							((u32&)RingBuffer.Regs[0x1010]) = remainder[1];
-							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = (GSRegSIGBLID&)remainder[2];
+							// The ring is mirrored, so the packet is contiguous even when it wraps around the end.
+							const RingCmdPacket_Vsync& packet = (RingCmdPacket_Vsync&)RingBuffer[(local_ReadPos + 1) & s_RingBufferMask];
+							std::memcpy(RingBuffer.Regs, packet.regset1, sizeof(packet.regset1));
+							((u32&)RingBuffer.Regs[0x1000]) = packet.csr;
+							((u32&)RingBuffer.Regs[0x1010]) = packet.imr;
+							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = packet.siglblid;
 
 							// CSR & 0x2000; is the pageflip id.
-							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0);
+							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, packet.registers_written != 0);
 
 							s_QueuedFrameCount.fetch_sub(1);
 							if (s_VsyncSignalListener.exchange(false))
@@ -555,7 +598,7 @@ void MTGS::MainLoop()
 				}
 			}
 
-			uint newringpos = (s_ReadPos.load(std::memory_order_relaxed) + ringposinc) & RingBufferMask;
+			uint newringpos = (s_ReadPos.load(std::memory_order_relaxed) + ringposinc) & s_RingBufferMask;
 
 			if (IsDevBuild && EmuConfig.GS.SynchronousMTGS) [[unlikely]]
 			{
@@ -616,6 +659,10 @@ void MTGS::WaitGS(bool syncRegs, bool weakWait, bool isMTVU)
 	// Both m_ReadPos and m_WritePos can be relaxed as we only want to test if the queue is empty but
 	// we don't want to access the content of the queue
 
+	// The MTVU thread only waits on path 1 packets, which are never held back.
+	if (!isMTVU)
+		FlushPendingGSPacket();
+
 	SetEvent();
 	if (weakWait && isMTVU)
 	{
@@ -663,7 +710,7 @@ void MTGS::SetEvent()
 
 u8* MTGS::GetDataPacketPtr()
 {
-	return (u8*)&RingBuffer[s_packet_writepos & RingBufferMask];
+	return (u8*)&RingBuffer[s_packet_writepos & s_RingBufferMask];
 }
 
 // Closes the data packet send command, and initiates the gs thread (if needed).
@@ -672,9 +719,9 @@ void MTGS::SendDataPacket()
 	// make sure a previous copy block has been started somewhere.
 	pxAssert(s_packet_size != 0);
 
-	uint actualSize = ((s_packet_writepos - s_packet_startpos) & RingBufferMask) - 1;
+	uint actualSize = ((s_packet_writepos - s_packet_startpos) & s_RingBufferMask) - 1;
 	pxAssert(actualSize <= s_packet_size);
-	pxAssert(s_packet_writepos < RingBufferSize);
+	pxAssert(s_packet_writepos < s_RingBufferSize);
 
 	PacketTagType& tag = (PacketTagType&)RingBuffer[s_packet_startpos];
 	tag.data[0] = actualSize;
@@ -705,8 +752,8 @@ void MTGS::GenericStall(uint size)
 	const uint writepos = s_WritePos.load(std::memory_order_relaxed);
 
 	// Sanity checks! (within the confines of our ringbuffer please!)
-	pxAssert(size < RingBufferSize);
-	pxAssert(writepos < RingBufferSize);
+	pxAssert(size < s_RingBufferSize);
+	pxAssert(writepos < s_RingBufferSize);
 
 	// generic gs wait/stall.
 	// if the writepos is past the readpos then we're safe.
@@ -719,10 +766,19 @@ void MTGS::GenericStall(uint size)
 	if (writepos < readpos)
 		freeroom = readpos - writepos;
 	else
-		freeroom = RingBufferSize - (writepos - readpos);
+		freeroom = s_RingBufferSize - (writepos - readpos);
+
+	const uint used = s_RingBufferSize - freeroom;
+	s_ProducerStats.occupancy[(static_cast<u64>(used) * std::size(s_ProducerStats.occupancy)) / s_RingBufferSize]++;
+	if ((used + size) > s_IntervalStats.high_water.load(std::memory_order_relaxed))
+		s_IntervalStats.high_water.store(used + size, std::memory_order_relaxed);
 
 	if (freeroom <= size)
 	{
+		const Common::Timer::Value stall_start = Common::Timer::GetCurrentValue();
+		s_ProducerStats.stalls++;
+		s_IntervalStats.stalls.fetch_add(1, std::memory_order_relaxed);
+
 		// writepos will overlap readpos if we commit the data, so we need to wait until
 		// readpos is out past the end of the future write pos, or until it wraps around
 		// (in which case writepos will be >= readpos).
@@ -731,7 +787,7 @@ void MTGS::GenericStall(uint size)
 		// the next packet will likely stall up too.  So lets set a condition for the MTGS
 		// thread to wake up the EE once there's a sizable chunk of the ringbuffer emptied.
 
-		uint somedone = (RingBufferSize - freeroom) / 4;
+		uint somedone = used / 4;
 		if (somedone < size + 1)
 			somedone = size + 1;
 
@@ -757,7 +813,7 @@ void MTGS::GenericStall(uint size)
 				if (writepos < readpos)
 					freeroom = readpos - writepos;
 				else
-					freeroom = RingBufferSize - (writepos - readpos);
+					freeroom = s_RingBufferSize - (writepos - readpos);
 
 				if (freeroom > size)
 					break;
@@ -777,17 +833,23 @@ void MTGS::GenericStall(uint size)
 				if (writepos < readpos)
 					freeroom = readpos - writepos;
 				else
-					freeroom = RingBufferSize - (writepos - readpos);
+					freeroom = s_RingBufferSize - (writepos - readpos);
 
 				if (freeroom > size)
 					break;
 			}
 		}
+
+		const Common::Timer::Value stall_ticks = Common::Timer::GetCurrentValue() - stall_start;
+		s_ProducerStats.stall_ticks += stall_ticks;
+		s_IntervalStats.stall_ticks.fetch_add(stall_ticks, std::memory_order_relaxed);
 	}
 }
 
 void MTGS::PrepDataPacket(Command cmd, u32 size)
 {
+	FlushPendingGSPacket();
+
 	s_packet_size = size;
 	++size; // takes into account our RingCommand QWC.
 	GenericStall(size);
@@ -800,7 +862,7 @@ void MTGS::PrepDataPacket(Command cmd, u32 size)
 	tag.command = static_cast<u32>(cmd);
 	tag.data[0] = s_packet_size;
 	s_packet_startpos = local_WritePos;
-	s_packet_writepos = (local_WritePos + 1) & RingBufferMask;
+	s_packet_writepos = (local_WritePos + 1) & s_RingBufferMask;
 }
 
 // Returns the amount of giftag data processed (in simd128 values).
@@ -817,7 +879,7 @@ void MTGS::PrepDataPacket(GIF_PATH pathidx, u32 size)
 
 __fi void MTGS::_FinishSimplePacket()
 {
-	uint future_writepos = (s_WritePos.load(std::memory_order_relaxed) + 1) & RingBufferMask;
+	uint future_writepos = (s_WritePos.load(std::memory_order_relaxed) + 1) & s_RingBufferMask;
 	pxAssert(future_writepos != s_ReadPos.load(std::memory_order_acquire));
 	s_WritePos.store(future_writepos, std::memory_order_release);
 
@@ -831,6 +893,7 @@ void MTGS::SendSimplePacket(Command type, int data0, int data1, int data2)
 {
 	//ScopedLock locker( m_PacketLocker );
 
+	FlushPendingGSPacket();
 	GenericStall(1);
 	PacketTagType& tag = (PacketTagType&)RingBuffer[s_WritePos.load(std::memory_order_relaxed)];
 
@@ -844,20 +907,96 @@ void MTGS::SendSimplePacket(Command type, int data0, int data1, int data2)
 
 void MTGS::SendSimpleGSPacket(Command type, u32 offset, u32 size, GIF_PATH path)
 {
-	SendSimplePacket(type, (int)offset, (int)size, (int)path);
+	if (IsDevBuild && EmuConfig.GS.SynchronousMTGS) [[unlikely]]
+	{
+		SendSimplePacket(type, (int)offset, (int)size, (int)path);
+		return;
+	}
 
-	if (!IsDevBuild || !EmuConfig.GS.SynchronousMTGS) [[likely]]
+	if (type == Command::GSPacket)
 	{
-		s_CopyDataTally += size / 16;
-		if (s_CopyDataTally > 0x2000)
-			SetEvent();
+		s_ProducerStats.gs_packets++;
+		if (!MergeGSPacket(offset, size, path))
+		{
+			FlushPendingGSPacket();
+			GenericStall(1);
+
+			PacketTagType& tag = (PacketTagType&)RingBuffer[s_WritePos.load(std::memory_order_relaxed)];
+			tag.command = static_cast<u32>(type);
+			tag.data[0] = offset;
+			tag.data[1] = size;
+			tag.data[2] = static_cast<u32>(path);
+			s_GSPacketPending = true;
+		}
+	}
+	else
+	{
+		SendSimplePacket(type, (int)offset, (int)size, (int)path);
+	}
+
+	s_CopyDataTally += size / 16;
+	if (s_CopyDataTally > 0x2000)
+	{
+		FlushPendingGSPacket();
+		SetEvent();
 	}
 }
 
+// Tries to append a GS packet to the held back command, publishing the command once it's big enough.
+bool MTGS::MergeGSPacket(u32 offset, u32 size, GIF_PATH path)
+{
+	if (!s_GSPacketPending)
+		return false;
+
+	PacketTagType& tag = (PacketTagType&)RingBuffer[s_WritePos.load(std::memory_order_relaxed)];
+	if (tag.data[2] != static_cast<u32>(path))
+		return false;
+
+	// Blank packets (offset ~0) only advance the read amount, so they can be merged with each other.
+	const bool blank = (offset == ~0u);
+	if (blank != (tag.data[0] == ~0u) || (!blank && offset != tag.data[0] + tag.data[1]))
+		return false;
+
+	tag.data[1] += size;
+	s_ProducerStats.merged_gs_packets++;
+
+	if (tag.data[1] >= GSPacketMergeLimit)
+		FlushPendingGSPacket();
+
+	return true;
+}
+
+// Makes the held back GS packet command visible to the GS thread.
+void MTGS::FlushPendingGSPacket()
+{
+	if (!s_GSPacketPending)
+		return;
+
+	s_GSPacketPending = false;
+	_FinishSimplePacket();
+}
+
+void MTGS::LogProducerStats()
+{
+	const ProducerStats& stats = s_ProducerStats;
+	if (stats.gs_packets == 0 && stats.stalls == 0)
+		return;
+
+	std::string occupancy;
+	for (size_t i = 0; i < stats.occupancy.size(); i++)
+		occupancy += fmt::format("{}{}", (i == 0) ? "" : "/", stats.occupancy[i]);
+
+	DevCon.WriteLn(fmt::format("MTGS: {} GS packets ({} merged), {} stalls ({:.2f} ms), ring occupancy (eighths): {}",
+		stats.gs_packets, stats.merged_gs_packets, stats.stalls, Common::Timer::ConvertValueToMilliseconds(stats.stall_ticks),
+		occupancy));
+	s_ProducerStats = {};
+}
+
 void MTGS::SendPointerPacket(Command type, u32 data0, void* data1)
 {
 	//ScopedLock locker( m_PacketLocker );
 
+	FlushPendingGSPacket();
 	GenericStall(1);
 	PacketTagType& tag = (PacketTagType&)RingBuffer[s_WritePos.load(std::memory_order_relaxed)];
 
@@ -875,6 +1014,10 @@ bool MTGS::WaitForOpen()
 
 	StartThread();
 
+	// Normally done by the hardware reset, but the GS can also be opened without a VM.
+	if (!s_RingMemory.IsValid())
+		AllocateRingBuffer();
+
 	// request open, and kick the thread.
 	s_open_flag.store(true, std::memory_order_release);
 	s_sem_event.NotifyOfWork();
@@ -895,6 +1038,9 @@ void MTGS::WaitForClose()
 	if (!IsOpen())
 		return;
 
+	FlushPendingGSPacket();
+	LogProducerStats();
+
 	// ask the thread to stop processing work, by clearing the open flag
 	s_open_flag.store(false, std::memory_order_release);
 
@@ -1055,8 +1201,8 @@ void Gif_AddCompletedGSPacket(GS_Packet& gsPack, GIF_PATH path)
 	if (COPY_GS_PACKET_TO_MTGS)
 	{
 		MTGS::PrepDataPacket(path, gsPack.size / 16);
-		MemCopy_WrappedDest((u128*)&gifUnit.gifPath[path].buffer[gsPack.offset], MTGS::RingBuffer.m_Ring,
-							MTGS::s_packet_writepos, MTGS::RingBufferSize, gsPack.size / 16);
+		std::memcpy(MTGS::GetDataPacketPtr(), &gifUnit.gifPath[path].buffer[gsPack.offset], gsPack.size);
+		MTGS::s_packet_writepos = (MTGS::s_packet_writepos + gsPack.size / 16) & MTGS::s_RingBufferMask;
 		MTGS::SendDataPacket();
 	}
 	else
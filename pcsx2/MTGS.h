@@ -4,6 +4,7 @@
 #pragma once
 
 #include "GS.h"
+#include "PerformanceMetrics.h"
 
 #include "common/Threading.h"
 
@@ -80,15 +81,12 @@ namespace MTGS
 	void SetRunIdle(bool enabled);
 
 	// Size of the ringbuffer as a power of 2 -- size is a multiple of simd128s.
-	// (actual size is 1<<m_RingBufferSizeFactor simd vectors [128-bit values])
+	// The actual size is picked from EmuConfig.GS.MTGSRingSize on VM start, this is just the default.
 	// A value of 19 is a 8meg ring buffer.  18 would be 4 megs, and 20 would be 16 megs.
 	// Default was 2mb, but some games with lots of MTGS activity want 8mb to run fast (rama)
-	static const uint RingBufferSizeFactor = 19;
+	static constexpr uint DefaultRingBufferSizeFactor = 19;
+	static constexpr uint DefaultRingBufferSize = 1 << DefaultRingBufferSizeFactor;
 
-	// size of the ringbuffer in simd128's.
-	static const uint RingBufferSize = 1 << RingBufferSizeFactor;
-
-	// Mask to apply to ring buffer indices to wrap the pointer from end to
-	// start (the wrapping is what makes it a ringbuffer, yo!)
-	static const uint RingBufferMask = RingBufferSize - 1;
+	/// Returns the producer statistics collected since the last call, and resets them.
+	PerformanceMetrics::RingStats GetAndResetRingStats();
 }
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Common.h"
+#include "IopHw.h"
+#include "MTIOP.h"
+#include "R3000A.h"
+#include "VMManager.h"
+#include "DebugTools/Breakpoints.h"
+#include "DebugTools/GuestProfiler.h"
+
+#include "common/FPControl.h"
+
+#include <thread>
+
+IopThread iopThread;
+
+static thread_local bool s_on_iop_thread = false;
+
+IopThread::IopThread() = default;
+
+IopThread::~IopThread()
+{
+	Close();
+}
+
+void IopThread::Open()
+{
+	if (IsOpen())
+		return;
+
+	m_sema.Reset();
+	m_shutdown_flag.store(false, std::memory_order_release);
+	m_slice_pending.store(false, std::memory_order_release);
+	m_slice_in_flight = false;
+	m_thread.SetStackSize(VMManager::EMU_THREAD_STACK_SIZE);
+	m_thread.Start([this]() { ThreadEntryPoint(); });
+}
+
+void IopThread::Close()
+{
+	if (!IsOpen())
+		return;
+
+	WaitIOP();
+	m_shutdown_flag.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+	m_thread.Join();
+}
+
+bool IopThread::CanRunThreaded()
+{
+	if (!THREAD_IOP)
+		return false;
+
+	// PS1 mode talks to the EE through PGIF, which isn't synchronized.
+	if (psxHu32(HW_ICFG) & (1 << 3))
+		return false;
+
+	// Breakpoints exit execution from the CPU thread.
+	return (CBreakPoints::GetNumBreakpoints() == 0 && CBreakPoints::GetNumMemchecks() == 0);
+}
+
+bool IopThread::IsOnIOPThread()
+{
+	return s_on_iop_thread;
+}
+
+bool IopThread::OwnsIOP() const
+{
+	return (s_on_iop_thread || !m_slice_in_flight);
+}
+
+void IopThread::ExecuteSlice()
+{
+	pxAssert(!m_slice_in_flight);
+
+	Open();
+
+	m_slice_in_flight = true;
+	m_slice_pending.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+}
+
+void IopThread::WaitIOP()
+{
+	if (!m_slice_in_flight || s_on_iop_thread)
+		return;
+
+	m_ee_waiting.store(true, std::memory_order_release);
+	m_sema.WaitForEmptyWithSpin();
+	m_ee_waiting.store(false, std::memory_order_relaxed);
+	m_slice_in_flight = false;
+}
+
+void IopThread::WaitForEE()
+{
+	if (!s_on_iop_thread)
+		return;
+
+	while (!m_ee_waiting.load(std::memory_order_acquire))
+		std::this_thread::yield();
+
+	// The EE is blocked until we finish, so don't keep it waiting for the rest of the slice.
+	if (psxRegs.iopCycleEE > 0)
+	{
+		psxRegs.iopBreak += psxRegs.iopCycleEE;
+		psxRegs.iopCycleEE = 0;
+	}
+}
+
+void IopThread::ThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("IOP");
+	s_on_iop_thread = true;
+
+	for (;;)
+	{
+		m_sema.WaitForWorkWithSpin();
+		if (m_shutdown_flag.load(std::memory_order_acquire))
+			break;
+
+		if (!m_slice_pending.exchange(false, std::memory_order_acquire))
+			continue;
+
+		// SPU2 mixes in floating point, keep it rounding the same way as when it runs on the EE thread.
+		FPControlRegister::SetCurrent(EmuConfig.Cpu.FPUFPCR);
+
+		const u32 start_pc = psxRegs.pc;
+		const u32 start_cycle = psxRegs.cycle;
+		EEsCycle = psxCpu->ExecuteBlock(EEsCycle);
+
+		if (GuestProfiler::IsActive())
+			GuestProfiler::Record(GuestProfiler::Source::IOP, start_pc, psxRegs.cycle - start_cycle);
+	}
+
+	m_sema.Kill();
+}
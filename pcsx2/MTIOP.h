@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Threading.h"
+
+#include <atomic>
+
+// Optionally runs the IOP, and the devices it drives (SPU2, CDVD, SIO2, USB, DEV9), on its own thread.
+//
+// Each EE event test waits for the previous IOP time slice to finish, runs the IOP's side of the event
+// test, and then starts the next slice, which runs alongside the EE until the following event test.
+// The IOP therefore lags the EE by at most one event test interval, which is bounded by the IOP's own
+// event wait (iopWaitCycles), much like running it inline with a larger time slice.
+//
+// Anything touching state which is shared between the two has to synchronize first:
+//  - The EE thread calls WaitIOP() before touching the SBUS registers or starting SIF DMAs.
+//  - The IOP thread calls WaitForEE() before running SIF DMAs, which parks until the EE thread is stuck
+//    in WaitIOP() (at its next event test at the latest), and then ends the slice early.
+class IopThread final
+{
+public:
+	IopThread();
+	~IopThread();
+
+	__fi const Threading::ThreadHandle& GetThreadHandle() const { return m_thread; }
+
+	/// Returns true if the IOP thread has been started.
+	__fi bool IsOpen() const { return m_thread.Joinable(); }
+
+	/// Ensures the IOP thread is started.
+	void Open();
+
+	/// Shuts down the IOP thread if it is currently running.
+	void Close();
+
+	/// Returns true if the next slice can run on the IOP thread. PS1 mode and the debugger need the IOP inline.
+	static bool CanRunThreaded();
+
+	/// Returns true if the calling thread is the IOP thread.
+	static bool IsOnIOPThread();
+
+	/// Returns true if the calling thread may touch the IOP's execution state (e.g. psxRegs.iopCycleEE),
+	/// i.e. it's the IOP thread, or the IOP isn't running on it.
+	bool OwnsIOP() const;
+
+	/// Starts running the IOP for EEsCycle cycles on the IOP thread. EEsCycle must not be touched until
+	/// WaitIOP() returns, at which point it holds what ExecuteBlock() returned.
+	void ExecuteSlice();
+
+	/// Waits for the current slice to finish, if any. Does nothing when called from the IOP thread.
+	void WaitIOP();
+
+	/// Waits until the EE thread is parked in WaitIOP(), so EE state can be touched, and ends the current
+	/// slice as soon as possible. Does nothing when not called from the IOP thread.
+	void WaitForEE();
+
+private:
+	void ThreadEntryPoint();
+
+	Threading::Thread m_thread;
+	Threading::WorkSema m_sema;
+	std::atomic_bool m_shutdown_flag{false};
+	std::atomic_bool m_slice_pending{false};
+	std::atomic_bool m_ee_waiting{false};
+
+	// Only accessed on the EE thread.
+	bool m_slice_in_flight = false;
+};
+
+extern IopThread iopThread;
@@ -6,6 +6,7 @@
 #include "MTVU.h"
 #include "VMManager.h"
 #include "Vif_Dynarec.h"
+#include "DebugTools/GuestProfiler.h"
 
 #include <thread>
 
@@ -27,7 +28,6 @@ enum MTVU_EVENT
 	MTVU_VIF_WRITE_COL,  // Write to Vif col reg
 	MTVU_VIF_WRITE_ROW,  // Write to Vif row reg
 	MTVU_VIF_UNPACK,     // Execute Vif Unpack
-	MTVU_NULL_PACKET,    // Go back to beginning of buffer
 	MTVU_RESET
 };
 
@@ -94,6 +94,7 @@ void VU_Thread::Open()
 	if (IsOpen())
 		return;
 
+	AllocateBuffer();
 	Reset();
 	semaEvent.Reset();
 	m_shutdown_flag.store(false, std::memory_order_release);
@@ -113,6 +114,10 @@ void VU_Thread::Close()
 
 void VU_Thread::Reset()
 {
+	// The thread is idle with nothing queued, so the ring can be resized if the config changed.
+	if (IsOpen())
+		AllocateBuffer();
+
 	vuCycleIdx = 0;
 	m_ato_write_pos = 0;
 	m_write_pos = 0;
@@ -125,6 +130,21 @@ void VU_Thread::Reset()
 	vu1Thread.mtvuInterrupts = 0;
 }
 
+void VU_Thread::AllocateBuffer()
+{
+	const s32 size = static_cast<s32>((static_cast<u64>(EmuConfig.GS.MTVURingSize) * _1mb) / sizeof(u32));
+	if (m_buffer_memory.IsValid() && size == buffer_size)
+		return;
+
+	if (!m_buffer_memory.Allocate("pcsx2_mtvu", size * sizeof(u32)))
+		pxFailRel("Failed to allocate MTVU ring buffer");
+
+	DevCon.WriteLn("MTVU: Allocated %u MB ring buffer", EmuConfig.GS.MTVURingSize);
+	buffer = reinterpret_cast<u32*>(m_buffer_memory.GetPointer());
+	buffer_size = size;
+	buffer_mask = size - 1;
+}
+
 void VU_Thread::ExecuteRingBuffer()
 {
 	Threading::SetNameOfCurrentThread("MTVU");
@@ -151,6 +171,8 @@ void VU_Thread::ExecuteRingBuffer()
 						VU1.VI[REG_TPC].UL = addr & 0x7FF;
 					CpuVU1->SetStartPC(VU1.VI[REG_TPC].UL << 3);
 					CpuVU1->Execute(vu1RunCycles);
+					if (GuestProfiler::IsActive())
+						GuestProfiler::Record(GuestProfiler::Source::VU1, VU1.start_pc, VU1.cycle);
 					gifUnit.gifPath[GIF_PATH_1].FinishGSPacketMTVU();
 					semaXGkick.Post(); // Tell MTGS a path1 packet is complete
 					vuCycles[vuCycleIdx].store(VU1.cycle, std::memory_order_release);
@@ -194,9 +216,6 @@ void VU_Thread::ExecuteRingBuffer()
 					m_read_pos += size_u32(size);
 					break;
 				}
-				case MTVU_NULL_PACKET:
-					m_read_pos = 0;
-					break;
 					jNO_DEFAULT;
 			}
 
@@ -211,27 +230,31 @@ void VU_Thread::ExecuteRingBuffer()
 // Should only be called by ReserveSpace()
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
-	for (;;)
+	// FIXME greg: there is a bug somewhere in the queue pointer
+	// management. It creates a deadlock/corruption in SotC intro (before
+	// the first menu). I added a 4KB safety net which seem to avoid to
+	// trigger the bug.
+	// Note: a wait lock instead of a yield also helps to avoid the bug.
+	s32 used = (m_write_pos - GetReadPos()) & buffer_mask;
+	if (static_cast<u32>(used + size) > m_high_water.load(std::memory_order_relaxed))
+		m_high_water.store(static_cast<u32>(used + size), std::memory_order_relaxed);
+	if (buffer_size - used > size + _4kb)
+		return; // Enough free space
+
+	const Common::Timer::Value stall_start = Common::Timer::GetCurrentValue();
+	m_stalls.fetch_add(1, std::memory_order_relaxed);
+	do
 	{
-		s32 readPos = GetReadPos();
-		if (readPos <= m_write_pos)
-			break; // MTVU is reading in back of write_pos
-		// FIXME greg: there is a bug somewhere in the queue pointer
-		// management. It creates a deadlock/corruption in SotC intro (before
-		// the first menu). I added a 4KB safety net which seem to avoid to
-		// trigger the bug.
-		// Note: a wait lock instead of a yield also helps to avoid the bug.
-		if (readPos > m_write_pos + size + _4kb)
-			break; // Enough free front space
-		{          // Let MTVU run to free up buffer space
-			KickStart();
-			// Locking might trigger a full flush of the ring buffer. Yield
-			// will be more aggressive, and only flush the minimal size.
-			// Performance will be smoother but it will consume extra CPU cycle
-			// on the EE thread (not an issue on 4 cores).
-			std::this_thread::yield();
-		}
-	}
+		// Let MTVU run to free up buffer space
+		KickStart();
+		// Locking might trigger a full flush of the ring buffer. Yield
+		// will be more aggressive, and only flush the minimal size.
+		// Performance will be smoother but it will consume extra CPU cycle
+		// on the EE thread (not an issue on 4 cores).
+		std::this_thread::yield();
+		used = (m_write_pos - GetReadPos()) & buffer_mask;
+	} while (buffer_size - used <= size + _4kb);
+	m_stall_ticks.fetch_add(Common::Timer::GetCurrentValue() - stall_start, std::memory_order_relaxed);
 }
 
 // Makes sure theres enough room in the ring buffer
@@ -239,18 +262,9 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 void VU_Thread::ReserveSpace(s32 size)
 {
 	pxAssert(m_write_pos < buffer_size);
-	pxAssert(size < buffer_size);
+	pxAssert(size < buffer_size - _4kb);
 	pxAssert(size > 0);
 
-	if (m_write_pos + size > (buffer_size - 1))
-	{
-		WaitOnSize(1); // Size of MTVU_NULL_PACKET
-		Write(MTVU_NULL_PACKET);
-		// Reset local write pointer/position
-		m_write_pos = 0;
-		CommitWritePos();
-	}
-
 	WaitOnSize(size);
 }
 
@@ -269,12 +283,13 @@ __fi s32 VU_Thread::GetWritePos()
 // Gets the effective write pointer after
 __fi u32* VU_Thread::GetWritePtr()
 {
-	pxAssert(m_write_pos < buffer_size);
+	pxAssert(m_write_pos < buffer_size * 2);
 	return &buffer[m_write_pos];
 }
 
 __fi void VU_Thread::CommitWritePos()
 {
+	m_write_pos &= buffer_mask;
 	m_ato_write_pos.store(m_write_pos, std::memory_order_release);
 
 	if (MTVU_ALWAYS_KICK)
@@ -285,6 +300,7 @@ __fi void VU_Thread::CommitWritePos()
 
 __fi void VU_Thread::CommitReadPos()
 {
+	m_read_pos &= buffer_mask;
 	m_ato_read_pos.store(m_read_pos, std::memory_order_release);
 }
 
@@ -337,6 +353,17 @@ __fi void VU_Thread::WriteRegs(VIFregisters* src)
 	m_write_pos += size_u32(sizeof(VIFregistersMTVU));
 }
 
+PerformanceMetrics::RingStats VU_Thread::GetAndResetRingStats()
+{
+	PerformanceMetrics::RingStats stats;
+	stats.stalls = m_stalls.exchange(0, std::memory_order_relaxed);
+	stats.stall_time = static_cast<float>(
+		Common::Timer::ConvertValueToMilliseconds(m_stall_ticks.exchange(0, std::memory_order_relaxed)));
+	stats.high_water = m_high_water.exchange(0, std::memory_order_relaxed) * sizeof(u32);
+	stats.size = buffer_size * sizeof(u32);
+	return stats;
+}
+
 // Returns Average number of vu Cycles from last 4 runs
 // Used for vu cycle stealing hack
 u32 VU_Thread::Get_vuCycles()
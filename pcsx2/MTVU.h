@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #pragma once
+#include "common/HostSys.h"
 #include "common/Threading.h"
+#include "common/Timer.h"
+#include "PerformanceMetrics.h"
 #include "Vif.h"
 #include "Vif_Dma.h"
 #include "VUmicro.h"
@@ -16,10 +19,14 @@
 // - This class should only be accessed from the EE thread...
 // - buffer_size must be power of 2
 // - ring-buffer has no complete pending packets when read_pos==write_pos
+// - the buffer is mirrored, so packets are written and read contiguously even when they wrap
+//   around the end; positions are only masked back into range when they are committed
 class VU_Thread final {
-	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
+	MirroredMemory m_buffer_memory;
+	u32* buffer = nullptr;
+	s32 buffer_size = 0; // in u32's, picked from EmuConfig.GS.MTVURingSize
+	s32 buffer_mask = 0;
 
-	u32 buffer[buffer_size];
 	// Note: keep atomic on separate cache line to avoid CPU conflict
 	alignas(__cachelinesize) std::atomic<int> m_ato_read_pos; // Only modified by VU thread
 	alignas(__cachelinesize) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
@@ -30,6 +37,11 @@ class VU_Thread final {
 
 	Threading::Thread m_thread;
 
+	// Producer stalls since the performance metrics last collected them (on the GS thread).
+	std::atomic<u64> m_stalls{0};
+	std::atomic<Common::Timer::Value> m_stall_ticks{0};
+	std::atomic<u32> m_high_water{0};
+
 public:
 	alignas(16)  vifStruct        vif;
 	alignas(16)  VIFregisters     vifRegs;
@@ -64,6 +76,7 @@ public:
 	/// Shuts down the VU thread if it is currently running.
 	void Close();
 
+	/// Must only be called while the ring is empty, since this is also where it picks up a new size.
 	void Reset();
 
 	// Get MTVU to start processing its packets if it isn't already
@@ -95,7 +108,11 @@ public:
 
 	void WriteRow(vifStruct& _vif);
 
+	/// Returns the producer statistics collected since the last call, and resets them.
+	PerformanceMetrics::RingStats GetAndResetRingStats();
+
 private:
+	void AllocateBuffer();
 	void ExecuteRingBuffer();
 
 	void WaitOnSize(s32 size);
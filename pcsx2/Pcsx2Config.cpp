@@ -18,6 +18,9 @@
 #include "USB/USB.h"
 
 #include "fmt/format.h"
+
+#include <bit>
+
 #ifdef _WIN32
 #include "common/RedtapeWindows.h"
 #include <KnownFolders.h>
@@ -236,6 +239,7 @@ static constexpr const char* s_speed_hack_names[] = {
 	"instantVU1",
 	"mtvu",
 	"eeCycleRate",
+	"fastLoad",
 };
 
 const char* Pcsx2Config::SpeedhackOptions::GetSpeedHackName(SpeedHack id)
@@ -273,6 +277,9 @@ void Pcsx2Config::SpeedhackOptions::Set(SpeedHack id, int value)
 		case SpeedHack::EECycleRate:
 			EECycleRate = static_cast<int>(std::clamp<int>(value, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE));
 			break;
+		case SpeedHack::FastLoad:
+			fastLoad = (value != 0);
+			break;
 			jNO_DEFAULT
 	}
 }
@@ -319,6 +326,9 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(vuFlagHack);
 	SettingsWrapBitBool(vuThread);
 	SettingsWrapBitBool(vu1Instant);
+	SettingsWrapBitBool(iopThread);
+	SettingsWrapBitBool(ipuThread);
+	SettingsWrapBitBool(fastLoad);
 
 	EECycleRate = std::clamp(EECycleRate, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE);
 	EECycleSkip = std::min(EECycleSkip, MAX_EE_CYCLE_SKIP);
@@ -361,11 +371,13 @@ Pcsx2Config::RecompilerOptions::RecompilerOptions()
 
 	EnableEE = true;
 	EnableEECache = false;
+	EnableEECachedInterpreter = true;
 	EnableIOP = true;
 	EnableVU0 = true;
 	EnableVU1 = true;
 	EnableFastmem = true;
 	PauseOnTLBMiss = false;
+	EnableAnalysisCache = true;
 
 	// vu and fpu clamping default to standard overflow.
 	vu0Overflow = true;
@@ -440,10 +452,12 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableEE);
 	SettingsWrapBitBool(EnableIOP);
 	SettingsWrapBitBool(EnableEECache);
+	SettingsWrapBitBool(EnableEECachedInterpreter);
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 	SettingsWrapBitBool(EnableFastmem);
 	SettingsWrapBitBool(PauseOnTLBMiss);
+	SettingsWrapBitBool(EnableAnalysisCache);
 
 	SettingsWrapBitBool(vu0Overflow);
 	SettingsWrapBitBool(vu0ExtraOverflow);
@@ -489,6 +503,7 @@ bool Pcsx2Config::RecompilerOptions::operator==(const RecompilerOptions& right)
 bool Pcsx2Config::CpuOptions::CpusChanged(const CpuOptions& right) const
 {
 	return (Recompiler.EnableEE != right.Recompiler.EnableEE ||
+			Recompiler.EnableEECachedInterpreter != right.Recompiler.EnableEECachedInterpreter ||
 			Recompiler.EnableIOP != right.Recompiler.EnableIOP ||
 			Recompiler.EnableVU0 != right.Recompiler.EnableVU0 ||
 			Recompiler.EnableVU1 != right.Recompiler.EnableVU1);
@@ -681,6 +696,8 @@ bool Pcsx2Config::GSOptions::operator==(const GSOptions& right) const
 	return (
 		OpEqu(SynchronousMTGS) &&
 		OpEqu(VsyncQueueSize) &&
+		OpEqu(MTGSRingSize) &&
+		OpEqu(MTVURingSize) &&
 
 		OpEqu(FramerateNTSC) &&
 		OpEqu(FrameratePAL) &&
@@ -805,6 +822,10 @@ void Pcsx2Config::GSOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(ExtendedUpscalingMultipliers);
 
 	SettingsWrapEntry(VsyncQueueSize);
+	SettingsWrapEntry(MTGSRingSize);
+	SettingsWrapEntry(MTVURingSize);
+	MTGSRingSize = std::bit_ceil(std::clamp(MTGSRingSize, MIN_RING_SIZE, MAX_RING_SIZE));
+	MTVURingSize = std::bit_ceil(std::clamp(MTVURingSize, MIN_RING_SIZE, MAX_RING_SIZE));
 
 	SettingsWrapEntry(FramerateNTSC);
 	SettingsWrapEntry(FrameratePAL);
@@ -1057,6 +1078,7 @@ std::optional<Pcsx2Config::SPU2Options::SPU2SyncMode> Pcsx2Config::SPU2Options::
 Pcsx2Config::SPU2Options::SPU2Options()
 {
 	bitset = 0;
+	BlockMixing = true;
 }
 
 void Pcsx2Config::SPU2Options::LoadSave(SettingsWrapper& wrap)
@@ -1075,6 +1097,7 @@ void Pcsx2Config::SPU2Options::LoadSave(SettingsWrapper& wrap)
 		SettingsWrapBitBoolEx(AccessLog, "Log_Register_Access");
 		SettingsWrapBitBoolEx(DMALog, "Log_DMA_Transfers");
 		SettingsWrapBitBoolEx(WaveLog, "Log_WAVE_Output");
+		SettingsWrapBitBoolEx(WaveLogVoices, "Log_WAVE_Voices");
 
 		SettingsWrapBitBoolEx(CoresDump, "Dump_Info");
 		SettingsWrapBitBoolEx(MemDump, "Dump_Memory");
@@ -1092,6 +1115,7 @@ void Pcsx2Config::SPU2Options::LoadSave(SettingsWrapper& wrap)
 			AccessLog = false;
 			DMALog = false;
 			WaveLog = false;
+			WaveLogVoices = false;
 			CoresDump = false;
 			MemDump = false;
 			RegDump = false;
@@ -1105,6 +1129,8 @@ void Pcsx2Config::SPU2Options::LoadSave(SettingsWrapper& wrap)
 		SettingsWrapEntry(OutputMuted);
 		SettingsWrapParsedEnum(Backend, "Backend", &AudioStream::ParseBackendName, &AudioStream::GetBackendName);
 		SettingsWrapParsedEnum(SyncMode, "SyncMode", &ParseSyncMode, &GetSyncModeName);
+		SettingsWrapBitBoolEx(BlockMixing, "BlockMixing");
+		SettingsWrapBitBoolEx(ThreadedMixing, "ThreadedMixing");
 		SettingsWrapEntry(DriverName);
 		SettingsWrapEntry(DeviceName);
 		StreamParameters.LoadSave(wrap, CURRENT_SETTINGS_SECTION);
@@ -53,6 +53,7 @@ static float s_vu_thread_usage = 0.0f;
 static float s_vu_thread_time = 0.0f;
 static float s_capture_thread_usage = 0.0f;
 static float s_capture_thread_time = 0.0f;
+static u32 s_capture_dropped_frames = 0;
 
 static PerformanceMetrics::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
@@ -71,6 +72,9 @@ static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
 static u32 s_presents_since_last_update = 0;
 
+static PerformanceMetrics::RingStats s_gs_ring_stats = {};
+static PerformanceMetrics::RingStats s_vu_ring_stats = {};
+
 void PerformanceMetrics::Clear()
 {
 	Reset();
@@ -90,10 +94,14 @@ void PerformanceMetrics::Clear()
 	s_vu_thread_time = 0.0f;
 	s_capture_thread_usage = 0.0f;
 	s_capture_thread_time = 0.0f;
+	s_capture_dropped_frames = 0;
 
 	s_average_gpu_time = 0.0f;
 	s_gpu_usage = 0.0f;
 
+	s_gs_ring_stats = {};
+	s_vu_ring_stats = {};
+
 	s_frame_number = 0;
 
 	s_frame_time_history.fill(0.0f);
@@ -120,10 +128,13 @@ void PerformanceMetrics::Reset()
 	s_last_gs_time = MTGS::GetThreadHandle().GetCPUTime();
 	s_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
 	s_last_ticks = GetCPUTicks();
-	s_last_capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadHandle().GetCPUTime() : 0;
+	s_last_capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadsCPUTime() : 0;
 
 	for (GSSWThreadStats& stat : s_gs_sw_threads)
 		stat.last_cpu_time = stat.handle.GetCPUTime();
+
+	MTGS::GetAndResetRingStats();
+	vu1Thread.GetAndResetRingStats();
 }
 
 void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_skipping_present)
@@ -192,7 +203,7 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 	const u64 cpu_time = s_cpu_thread_handle.GetCPUTime();
 	const u64 gs_time = MTGS::GetThreadHandle().GetCPUTime();
 	const u64 vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
-	const u64 capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadHandle().GetCPUTime() : 0;
+	const u64 capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadsCPUTime() : 0;
 
 	const u64 cpu_delta = cpu_time - s_last_cpu_time;
 	const u64 gs_delta = gs_time - s_last_gs_time;
@@ -211,6 +222,7 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 	s_gs_thread_time = static_cast<double>(gs_delta) * time_divider;
 	s_vu_thread_time = static_cast<double>(vu_delta) * time_divider;
 	s_capture_thread_time = static_cast<double>(capture_delta) * time_divider;
+	s_capture_dropped_frames = GSCapture::IsCapturing() ? GSCapture::GetDroppedFrameCount() : 0;
 
 	for (GSSWThreadStats& thread : s_gs_sw_threads)
 	{
@@ -221,6 +233,9 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 		thread.time = static_cast<double>(delta) * time_divider;
 	}
 
+	s_gs_ring_stats = MTGS::GetAndResetRingStats();
+	s_vu_ring_stats = vu1Thread.GetAndResetRingStats();
+
 	s_frames_since_last_update = 0;
 	s_unskipped_frames_since_last_update = 0;
 	s_presents_since_last_update = 0;
@@ -337,6 +352,11 @@ float PerformanceMetrics::GetCaptureThreadAverageTime()
 	return s_capture_thread_time;
 }
 
+u32 PerformanceMetrics::GetCaptureDroppedFrames()
+{
+	return s_capture_dropped_frames;
+}
+
 u32 PerformanceMetrics::GetGSSWThreadCount()
 {
 	return static_cast<u32>(s_gs_sw_threads.size());
@@ -362,6 +382,16 @@ float PerformanceMetrics::GetGPUAverageTime()
 	return s_average_gpu_time;
 }
 
+const PerformanceMetrics::RingStats& PerformanceMetrics::GetGSRingStats()
+{
+	return s_gs_ring_stats;
+}
+
+const PerformanceMetrics::RingStats& PerformanceMetrics::GetVURingStats()
+{
+	return s_vu_ring_stats;
+}
+
 const PerformanceMetrics::FrameTimeHistory& PerformanceMetrics::GetFrameTimeHistory()
 {
 	return s_frame_time_history;
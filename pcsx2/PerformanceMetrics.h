@@ -18,6 +18,15 @@ namespace PerformanceMetrics
 	static constexpr u32 NUM_FRAME_TIME_SAMPLES = 150;
 	using FrameTimeHistory = std::array<float, NUM_FRAME_TIME_SAMPLES>;
 
+	/// Producer-side statistics for the MTGS and MTVU command rings.
+	struct RingStats
+	{
+		u64 stalls; // Number of times the EE had to wait for the consumer to free up space.
+		float stall_time; // Time spent waiting, in milliseconds.
+		u32 high_water; // Highest occupancy seen, in bytes.
+		u32 size; // Ring size, in bytes.
+	};
+
 	void Clear();
 	void Reset();
 	void Update(bool gs_register_write, bool fb_blit, bool is_skipping_present);
@@ -50,6 +59,7 @@ namespace PerformanceMetrics
 	float GetVUThreadAverageTime();
 	float GetCaptureThreadUsage();
 	float GetCaptureThreadAverageTime();
+	u32 GetCaptureDroppedFrames();
 
 	u32 GetGSSWThreadCount();
 	double GetGSSWThreadUsage(u32 index);
@@ -58,6 +68,10 @@ namespace PerformanceMetrics
 	float GetGPUUsage();
 	float GetGPUAverageTime();
 
+	/// Ring statistics for the last update interval.
+	const RingStats& GetGSRingStats();
+	const RingStats& GetVURingStats();
+
 	const FrameTimeHistory& GetFrameTimeHistory();
 	u32 GetFrameTimeHistoryPos();
 } // namespace PerformanceMetrics
@@ -3,6 +3,7 @@
 
 #include "R3000A.h"
 #include "Common.h"
+#include "CycleEventQueue.h"
 
 #include "SIO/Sio0.h"
 #include "Sif.h"
@@ -12,6 +13,7 @@
 #include "IopBios.h"
 #include "IopHw.h"
 #include "IopDma.h"
+#include "MTIOP.h"
 #include "CDVD/Ps1CD.h"
 #include "CDVD/CDVD.h"
 
@@ -34,9 +36,13 @@ bool iopEventTestIsActive = false;
 
 alignas(16) psxRegisters psxRegs;
 
+// Pending psxRegs.interrupt events, ordered by the cycle they're due on.
+static CycleEventQueue<32> s_iopEvents;
+
 void psxReset()
 {
 	std::memset(&psxRegs, 0, sizeof(psxRegs));
+	s_iopEvents.Clear();
 
 	psxRegs.pc = 0xbfc00000; // Start in bootstrap
 	psxRegs.CP0.n.Status = 0x00400000; // BEV = 1
@@ -134,12 +140,14 @@ __fi void PSX_INT( IopEventId n, s32 ecycle )
 
 	psxRegs.sCycle[n] = psxRegs.cycle;
 	psxRegs.eCycle[n] = ecycle;
+	s_iopEvents.Schedule(n, psxRegs.cycle + ecycle);
 
 	psxSetNextBranchDelta(ecycle);
 	const float mutiplier = static_cast<float>(PS2CLK) / static_cast<float>(PSXCLK);
 	const s32 iopDelta = (psxRegs.iopNextEventCycle - psxRegs.cycle) * mutiplier;
 
-	if (psxRegs.iopCycleEE < iopDelta)
+	// A threaded IOP is already running its slice, and the EE's event timing isn't ours to touch.
+	if (psxRegs.iopCycleEE < iopDelta && !IopThread::IsOnIOPThread())
 	{
 		// The EE called this int, so inform it to branch as needed:
 		
@@ -147,6 +155,24 @@ __fi void PSX_INT( IopEventId n, s32 ecycle )
 	}
 }
 
+void psxRebuildEventQueue()
+{
+	s_iopEvents.Clear();
+	for (u32 i = 0; i < 32; i++)
+	{
+		if (psxRegs.interrupt & (1u << i))
+			s_iopEvents.Schedule(i, psxRegs.sCycle[i] + psxRegs.eCycle[i]);
+	}
+}
+
+// Events which aren't due yet don't need visiting, the queue knows the earliest one.
+static __fi void psxScheduleNextInterrupt()
+{
+	s_iopEvents.Prune(psxRegs.interrupt);
+	if (!s_iopEvents.IsEmpty() && static_cast<s32>(s_iopEvents.GetNextDeadline() - psxRegs.cycle) > 0)
+		psxSetNextBranch(s_iopEvents.GetNextDeadline(), 0);
+}
+
 static __fi void IopTestEvent( IopEventId n, void (*callback)() )
 {
 	if( !(psxRegs.interrupt & (1 << n)) ) return;
@@ -154,10 +180,11 @@ static __fi void IopTestEvent( IopEventId n, void (*callback)() )
 	if( psxTestCycle( psxRegs.sCycle[n], psxRegs.eCycle[n] ) )
 	{
 		psxRegs.interrupt &= ~(1 << n);
+		s_iopEvents.Cancel(n);
 		callback();
 	}
 	else
-		psxSetNextBranch( psxRegs.sCycle[n], psxRegs.eCycle[n] );
+		s_iopEvents.Schedule(n, psxRegs.sCycle[n] + psxRegs.eCycle[n]);
 }
 
 static __fi void Sio0TestEvent(IopEventId n)
@@ -170,11 +197,12 @@ static __fi void Sio0TestEvent(IopEventId n)
 	if (psxTestCycle(psxRegs.sCycle[n], psxRegs.eCycle[n]))
 	{
 		psxRegs.interrupt &= ~(1 << n);
+		s_iopEvents.Cancel(n);
 		g_Sio0.Interrupt(Sio0Interrupt::TEST_EVENT);
 	}
 	else
 	{
-		psxSetNextBranch(psxRegs.sCycle[n], psxRegs.eCycle[n]);
+		s_iopEvents.Schedule(n, psxRegs.sCycle[n] + psxRegs.eCycle[n]);
 	}
 }
 
@@ -223,9 +251,15 @@ __ri void iopEventTest()
 
 	if (psxRegs.interrupt)
 	{
-		iopEventTestIsActive = true;
-		_psxTestInterrupts();
-		iopEventTestIsActive = false;
+		s_iopEvents.Prune(psxRegs.interrupt);
+		if (s_iopEvents.IsDue(psxRegs.cycle))
+		{
+			iopEventTestIsActive = true;
+			_psxTestInterrupts();
+			iopEventTestIsActive = false;
+		}
+
+		psxScheduleNextInterrupt();
 	}
 
 	if ((psxHu32(0x1078) != 0) && ((psxHu32(0x1070) & psxHu32(0x1074)) != 0))
@@ -244,7 +278,9 @@ void iopTestIntc()
 	if( psxHu32(0x1078) == 0 ) return;
 	if( (psxHu32(0x1070) & psxHu32(0x1074)) == 0 ) return;
 
-	if( !eeEventTestIsActive )
+	// The EE's event test flag belongs to the EE thread, don't touch it from the IOP thread. The IOP thread
+	// runs its own branch tests, so it only needs to schedule one.
+	if( !IopThread::IsOnIOPThread() && !eeEventTestIsActive )
 	{
 		// An iop exception has occurred while the EE is running code.
 		// Inform the EE to branch so the IOP can handle it promptly:
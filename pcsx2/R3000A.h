@@ -196,6 +196,7 @@ extern R3000Acpu psxRec;
 extern void psxReset();
 extern void psxException(u32 code, u32 step);
 extern void iopEventTest();
+extern void psxRebuildEventQueue();
 
 int psxIsBreakpointNeeded(u32 addr);
 int psxIsMemcheckNeeded(u32 pc);
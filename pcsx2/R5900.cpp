@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Common.h"
+#include "Cache.h"
+#include "CycleEventQueue.h"
 
 #include "common/StringUtil.h"
 #include "ps2/BiosTools.h"
@@ -10,6 +12,7 @@
 #include "ps2/pgif.h" // pgif init
 #include "VUmicro.h"
 #include "COP0.h"
+#include "MTIOP.h"
 #include "MTVU.h"
 #include "VMManager.h"
 
@@ -23,6 +26,7 @@
 #include "GSDumpReplayer.h"
 
 #include "DebugTools/Breakpoints.h"
+#include "DebugTools/GuestProfiler.h"
 #include "DebugTools/MIPSAnalyst.h"
 #include "DebugTools/SymbolGuardian.h"
 #include "R5900OpcodeTables.h"
@@ -43,6 +47,9 @@ static constexpr uint eeWaitCycles = 3072;
 bool eeEventTestIsActive = false;
 EE_intProcessStatus eeRunInterruptScan = INT_NOT_RUNNING;
 
+// Pending cpuRegs.interrupt events, ordered by the cycle they're due on.
+static CycleEventQueue<32> s_eeEvents;
+
 u32 g_eeloadMain = 0, g_eeloadExec = 0, g_osdsys_str = 0;
 
 /* I don't know how much space for args there is in the memory block used for args in full boot mode,
@@ -59,6 +66,7 @@ void cpuReset()
 	std::memset(&cpuRegs, 0, sizeof(cpuRegs));
 	std::memset(&fpuRegs, 0, sizeof(fpuRegs));
 	std::memset(&tlb, 0, sizeof(tlb));
+	s_eeEvents.Clear();
 
 	cpuRegs.pc				= 0xbfc00000; //set pc reg to stack
 	cpuRegs.CP0.n.Config	= 0x440;
@@ -67,6 +75,9 @@ void cpuReset()
 	fpuRegs.fprc[0]			= 0x00002e30; // fpu Revision..
 	fpuRegs.fprc[31]		= 0x01000001; // fpu Status/Control
 
+	resetCache();
+	vtlb_UpdateCacheMap();
+
 	cpuRegs.nextEventCycle = cpuRegs.cycle + 4;
 	EEsCycle = 0;
 	EEoCycle = cpuRegs.cycle;
@@ -237,6 +248,26 @@ __fi void cpuClearInt( uint i )
 	pxAssume( i < 32 );
 	cpuRegs.interrupt &= ~(1 << i);
 	cpuRegs.dmastall &= ~(1 << i);
+	s_eeEvents.Cancel(i);
+}
+
+void cpuRebuildEventQueue()
+{
+	s_eeEvents.Clear();
+	for (u32 i = 0; i < 32; i++)
+	{
+		if (cpuRegs.interrupt & (1u << i))
+			s_eeEvents.Schedule(i, cpuRegs.sCycle[i] + cpuRegs.eCycle[i]);
+	}
+}
+
+// Schedules the next event test for the earliest pending interrupt. Ones which are already due
+// but couldn't run (DMAC disabled) are left to the regular event tests, same as before.
+static __fi void _cpuScheduleNextInterrupt()
+{
+	s_eeEvents.Prune(cpuRegs.interrupt);
+	if (!s_eeEvents.IsEmpty() && static_cast<s32>(s_eeEvents.GetNextDeadline() - cpuRegs.cycle) > 0)
+		cpuSetNextEvent(s_eeEvents.GetNextDeadline(), 0);
 }
 
 static __fi void TESTINT( u8 n, void (*callback)() )
@@ -249,7 +280,11 @@ static __fi void TESTINT( u8 n, void (*callback)() )
 		callback();
 	}
 	else
-		cpuSetNextEvent( cpuRegs.sCycle[n], cpuRegs.eCycle[n] );
+	{
+		// Not due yet, _cpuScheduleNextInterrupt() picks it up. Refresh the queued cycle in case
+		// eCycle was poked directly (IPU does this to park DMAC_TO_IPU).
+		s_eeEvents.Schedule(n, cpuRegs.sCycle[n] + cpuRegs.eCycle[n]);
+	}
 }
 
 // [TODO] move this function to Dmac.cpp, and remove most of the DMAC-related headers from
@@ -357,9 +392,17 @@ static bool cpuIntsEnabled(int Interrupt)
 // and the recompiler.  (moved here to help alleviate redundant code)
 __fi void _cpuEventTest_Shared()
 {
+	// When the IOP has its own thread, the slice started at the end of the previous event test has been
+	// running alongside the EE, and events here can touch its state, so it needs to finish first.
+	iopThread.WaitIOP();
+
+	// Likewise for an IPU command started by the previous event test, whose events are raised here.
+	ipuThread.WaitIPU();
+
 	eeEventTestIsActive = true;
 	cpuRegs.nextEventCycle = cpuRegs.cycle + eeWaitCycles;
 	cpuRegs.lastEventCycle = cpuRegs.cycle;
+
 	// ---- INTC / DMAC (CPU-level Exceptions) -----------------
 	// Done first because exceptions raised during event tests need to be postponed a few
 	// cycles (fixes Grandia II [PAL], which does a spin loop on a vsync and expects to
@@ -379,19 +422,26 @@ __fi void _cpuEventTest_Shared()
 	//   cpuEventTest, the IOP generally starts to run way ahead of the EE.
 
 	// It's also important to sync up the IOP before updating the timers, since gates will depend on starting/stopping in the right place!
+	const bool threaded_iop = IopThread::CanRunThreaded();
+
 	EEsCycle += cpuRegs.cycle - EEoCycle;
 	EEoCycle = cpuRegs.cycle;
 
 	if (EEsCycle > 0)
 		iopEventAction = true;
 
-	if (iopEventAction)
+	if (iopEventAction && !threaded_iop)
 	{
 		//if( EEsCycle < -450 )
 		//	Console.WriteLn( " IOP ahead by: %d cycles", -EEsCycle );
 
+		const u32 iop_start_pc = psxRegs.pc;
+		const u32 iop_start_cycle = psxRegs.cycle;
 		EEsCycle = psxCpu->ExecuteBlock(EEsCycle);
 
+		if (GuestProfiler::IsActive())
+			GuestProfiler::Record(GuestProfiler::Source::IOP, iop_start_pc, psxRegs.cycle - iop_start_cycle);
+
 		iopEventAction = false;
 	}
 
@@ -411,6 +461,10 @@ __fi void _cpuEventTest_Shared()
 
 	if (cpuRegs.interrupt)
 	{
+		// Only scan the event list when the earliest event is due, it's ordered by due cycle so
+		// otherwise there's nothing to do besides scheduling the next test for it.
+		s_eeEvents.Prune(cpuRegs.interrupt);
+
 		// This is a BIOS hack because the coding in the BIOS is terrible but the bug is masked by Data Cache
 		// where a DMA buffer is overwritten without waiting for the transfer to end, which causes the fonts to get all messed up
 		// so to fix it, we run all the DMA's instantly when in the BIOS.
@@ -420,8 +474,10 @@ __fi void _cpuEventTest_Shared()
 			while ((cpuRegs.interrupt & 0x1FFFF) && _cpuTestInterrupts())
 				;
 		}
-		else
+		else if (CHECK_INSTANTDMAHACK || s_eeEvents.IsDue(cpuRegs.cycle))
 			_cpuTestInterrupts();
+
+		_cpuScheduleNextInterrupt();
 	}
 
 	// ---- VU Sync -------------
@@ -431,10 +487,12 @@ __fi void _cpuEventTest_Shared()
 	CpuVU1->ExecuteBlock();
 
 	// ---- Schedule Next Event Test --------------
+	// A threaded IOP is about to catch up by itself, so only its next event matters.
+	const s32 iop_behind = threaded_iop ? 0 : EEsCycle;
 	const float mutiplier = static_cast<float>(PS2CLK) / static_cast<float>(PSXCLK);
 	const int nextIopEventDeta = ((psxRegs.iopNextEventCycle - psxRegs.cycle) * mutiplier);
 	// 8 or more cycles behind and there's an event scheduled
-	if (EEsCycle >= nextIopEventDeta)
+	if (iop_behind >= nextIopEventDeta)
 	{
 		// EE's running way ahead of the IOP still, so we should branch quickly to give the
 		// IOP extra timeslices in short order.
@@ -445,12 +503,23 @@ __fi void _cpuEventTest_Shared()
 	else
 	{
 		// Otherwise IOP is caught up/not doing anything so we can wait for the next event.
-		cpuSetNextEventDelta(((psxRegs.iopNextEventCycle - psxRegs.cycle) * mutiplier) - EEsCycle);
+		cpuSetNextEventDelta(((psxRegs.iopNextEventCycle - psxRegs.cycle) * mutiplier) - iop_behind);
 	}
 
 	// Apply vsync and other counter nextCycles
 	cpuSetNextEvent(nextStartCounter, nextDeltaCounter);
 
+	if (threaded_iop && iopEventAction)
+	{
+		iopEventAction = false;
+		iopThread.ExecuteSlice();
+	}
+
+	// Sampled last, after any exception has been taken, so the PC is where the EE resumes from, and the cycles
+	// until the next event test are charged to it.
+	if (GuestProfiler::IsActive())
+		GuestProfiler::Sample(GuestProfiler::Source::EE, cpuRegs.pc, cpuRegs.cycle);
+
 	eeEventTestIsActive = false;
 }
 
@@ -465,7 +534,7 @@ __ri void cpuTestINTCInts()
 		return;
 
 	cpuSetNextEventDelta(4);
-	if (eeEventTestIsActive && (psxRegs.iopCycleEE > 0))
+	if (eeEventTestIsActive && (psxRegs.iopCycleEE > 0) && iopThread.OwnsIOP())
 	{
 		psxRegs.iopBreak += psxRegs.iopCycleEE; // record the number of cycles the IOP didn't run.
 		psxRegs.iopCycleEE = 0;
@@ -484,7 +553,7 @@ __fi void cpuTestDMACInts()
 		return;
 
 	cpuSetNextEventDelta(4);
-	if (eeEventTestIsActive && (psxRegs.iopCycleEE > 0))
+	if (eeEventTestIsActive && (psxRegs.iopCycleEE > 0) && iopThread.OwnsIOP())
 	{
 		psxRegs.iopBreak += psxRegs.iopCycleEE; // record the number of cycles the IOP didn't run.
 		psxRegs.iopCycleEE = 0;
@@ -525,6 +594,7 @@ __fi void CPU_INT( EE_EventType n, s32 ecycle)
 		cpuRegs.interrupt |= 1 << n;
 		cpuRegs.sCycle[n] = cpuRegs.cycle;
 		cpuRegs.eCycle[n] = 0;
+		s_eeEvents.Schedule(n, cpuRegs.cycle);
 		return;
 	}
 
@@ -537,10 +607,11 @@ __fi void CPU_INT( EE_EventType n, s32 ecycle)
 	cpuRegs.interrupt |= 1 << n;
 	cpuRegs.sCycle[n] = cpuRegs.cycle;
 	cpuRegs.eCycle[n] = ecycle;
+	s_eeEvents.Schedule(n, cpuRegs.cycle + ecycle);
 
 	// Interrupt is happening soon: make sure both EE and IOP are aware.
 
-	if (ecycle <= 28 && psxRegs.iopCycleEE > 0)
+	if (ecycle <= 28 && psxRegs.iopCycleEE > 0 && iopThread.OwnsIOP())
 	{
 		// If running in the IOP, force it to break immediately into the EE.
 		// the EE's branch test is due to run.
@@ -335,6 +335,7 @@ extern void cpuTlbMissR(u32 addr, u32 bd);
 extern void cpuTlbMissW(u32 addr, u32 bd);
 extern void cpuTestHwInts();
 extern void cpuClearInt(uint n);
+extern void cpuRebuildEventQueue();
 extern void GoemonPreloadTlb();
 extern void GoemonUnloadTlb(u32 key);
 
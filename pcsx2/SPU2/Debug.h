@@ -24,6 +24,7 @@ namespace SPU2
 	__fi static bool AccessLog() { return EmuConfig.SPU2.AccessLog; }
 	__fi static bool DMALog() { return EmuConfig.SPU2.DMALog; }
 	__fi static bool WaveLog() { return EmuConfig.SPU2.WaveLog; }
+	__fi static bool WaveLogVoices() { return EmuConfig.SPU2.WaveLog && EmuConfig.SPU2.WaveLogVoices; }
 
 	__fi static bool CoresDump() { return EmuConfig.SPU2.CoresDump; }
 	__fi static bool MemDump() { return EmuConfig.SPU2.MemDump; }
@@ -52,6 +53,7 @@ namespace SPU2
 	__fi static constexpr bool AccessLog() { return false; }
 	__fi static constexpr bool DMALog() { return false; }
 	__fi static constexpr bool WaveLog() { return false; }
+	__fi static constexpr bool WaveLogVoices() { return false; }
 
 	__fi static constexpr bool CoresDump() { return false; }
 	__fi static constexpr bool MemDump() { return false; }
@@ -95,6 +97,9 @@ namespace WaveDump
 	extern void Close();
 	extern void WriteCore(uint coreidx, CoreSourceType src, s16 left, s16 right);
 	extern void WriteCore(uint coreidx, CoreSourceType src, const StereoOut32& sample);
+
+	/// Output of a single voice, after its volume is applied. Only dumped when Log_WAVE_Voices is set.
+	extern void WriteVoice(uint coreidx, uint voiceidx, const StereoOut32& sample);
 } // namespace WaveDump
 
 using WaveDump::CoreSrc_DryVoiceMix;
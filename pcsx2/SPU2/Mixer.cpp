@@ -7,6 +7,8 @@
 #include "SPU2/spu2.h"
 #include "SPU2/interpolate_table.h"
 
+#include "GS/GSVector.h"
+
 #include "common/Assertions.h"
 
 static const s32 tbl_XA_Factor[16][2] =
@@ -457,20 +459,204 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
+// Voice state for one output sample of a core, in structure-of-arrays form so the interpolation,
+// envelope, volume and gates can be applied to four voices at a time.
+struct alignas(16) VoiceLanes
+{
+	s32 Taps[4][V_Core::NumVoices];
+	s32 Samples[4][V_Core::NumVoices];
+	s32 Envelope[V_Core::NumVoices];
+	s32 VolumeL[V_Core::NumVoices];
+	s32 VolumeR[V_Core::NumVoices];
+	s32 Gates[4][V_Core::NumVoices];
+	s32 Out[V_Core::NumVoices];
+	u32 ActiveMask;
+};
+
+static_assert((V_Core::NumVoices % 4) == 0);
+
+// Does everything for a voice which can't be done in lanes (sample fetching, ADSR and IRQs), in the same
+// order as MixVoice(), leaving the interpolation and volumes to MixVoiceLanes().
+static __forceinline void GatherVoice(VoiceLanes& lanes, uint coreidx, uint voiceidx)
+{
+	V_Core& thiscore(Cores[coreidx]);
+	V_Voice& vc(thiscore.Voices[voiceidx]);
+
+	pxAssertMsg((vc.SCurrent <= 28) && (vc.SCurrent != 0), "Current sample should always range from 1->28");
+
+	vc.Volume.Update();
+	UpdatePitch(coreidx, voiceidx);
+
+	s32 Value = 0;
+
+	if (vc.ADSR.Phase > V_ADSR::PHASE_STOPPED)
+	{
+		if (vc.Noise)
+		{
+			// 0x8000 passes the noise through the interpolation unchanged.
+			lanes.Taps[0][voiceidx] = lanes.Taps[1][voiceidx] = lanes.Taps[2][voiceidx] = 0;
+			lanes.Taps[3][voiceidx] = 0x8000;
+			lanes.Samples[0][voiceidx] = lanes.Samples[1][voiceidx] = lanes.Samples[2][voiceidx] = 0;
+			lanes.Samples[3][voiceidx] = GetNoiseValues(thiscore);
+		}
+		else
+		{
+			while (vc.SP >= 0)
+			{
+				vc.PV4 = vc.PV3;
+				vc.PV3 = vc.PV2;
+				vc.PV2 = vc.PV1;
+				vc.PV1 = GetNextDataBuffered(thiscore, voiceidx);
+				vc.SP -= 0x1000;
+			}
+
+			const s32 mu = vc.SP + 0x1000;
+			const auto& taps = interpTable[(mu & 0x0ff0) >> 4];
+			for (int i = 0; i < 4; i++)
+				lanes.Taps[i][voiceidx] = taps[i];
+			lanes.Samples[0][voiceidx] = vc.PV4;
+			lanes.Samples[1][voiceidx] = vc.PV3;
+			lanes.Samples[2][voiceidx] = vc.PV2;
+			lanes.Samples[3][voiceidx] = vc.PV1;
+		}
+
+		CalculateADSR(thiscore, voiceidx);
+		lanes.Envelope[voiceidx] = vc.ADSR.Value;
+
+		lanes.ActiveMask |= 1u << voiceidx;
+
+		// Voices 1 and 3 are written back before the following voices fetch, since they could read them.
+		if (voiceidx == 1 || voiceidx == 3)
+		{
+			for (int i = 0; i < 4; i++)
+				Value += (lanes.Taps[i][voiceidx] * lanes.Samples[i][voiceidx]) >> 15;
+			Value = ApplyVolume(Value, vc.ADSR.Value);
+		}
+	}
+	else
+	{
+		while (vc.SP >= 0)
+			GetNextDataDummy(thiscore, voiceidx); // Dummy is enough
+
+		for (int i = 0; i < 4; i++)
+			lanes.Taps[i][voiceidx] = lanes.Samples[i][voiceidx] = 0;
+		lanes.Envelope[voiceidx] = 0;
+	}
+
+	lanes.VolumeL[voiceidx] = vc.Volume.Left.Value;
+	lanes.VolumeR[voiceidx] = vc.Volume.Right.Value;
+	lanes.Gates[0][voiceidx] = thiscore.VoiceGates[voiceidx].DryL;
+	lanes.Gates[1][voiceidx] = thiscore.VoiceGates[voiceidx].DryR;
+	lanes.Gates[2][voiceidx] = thiscore.VoiceGates[voiceidx].WetL;
+	lanes.Gates[3][voiceidx] = thiscore.VoiceGates[voiceidx].WetR;
+
+	// Write-back of raw voice data (post ADSR applied)
+	if (voiceidx == 1)
+		spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, Value);
+	else if (voiceidx == 3)
+		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
+}
+
+static __forceinline s32 SumLanes(const GSVector4i& v)
+{
+	return v.extract32<0>() + v.extract32<1>() + v.extract32<2>() + v.extract32<3>();
+}
+
+static __forceinline void MixVoiceLanes(VoiceMixSet& dest, VoiceLanes& lanes)
+{
+	GSVector4i dry_l = GSVector4i::zero();
+	GSVector4i dry_r = GSVector4i::zero();
+	GSVector4i wet_l = GSVector4i::zero();
+	GSVector4i wet_r = GSVector4i::zero();
+
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; voiceidx += 4)
+	{
+		// Same as GaussianInterpolate(), each tap is shifted before summing.
+		GSVector4i value = GSVector4i::zero();
+		for (int i = 0; i < 4; i++)
+		{
+			const GSVector4i taps = GSVector4i::load<true>(&lanes.Taps[i][voiceidx]);
+			const GSVector4i samples = GSVector4i::load<true>(&lanes.Samples[i][voiceidx]);
+			value = value.add32(taps.mul32l(samples).sra32<15>());
+		}
+
+		value = value.mul32l(GSVector4i::load<true>(&lanes.Envelope[voiceidx])).sra32<15>();
+		GSVector4i::store<true>(&lanes.Out[voiceidx], value);
+
+		// Note: Voice outputs are ranged at 16 bits.
+		const GSVector4i left = value.mul32l(GSVector4i::load<true>(&lanes.VolumeL[voiceidx])).sra32<15>();
+		const GSVector4i right = value.mul32l(GSVector4i::load<true>(&lanes.VolumeR[voiceidx])).sra32<15>();
+		dry_l = dry_l.add32(left & GSVector4i::load<true>(&lanes.Gates[0][voiceidx]));
+		dry_r = dry_r.add32(right & GSVector4i::load<true>(&lanes.Gates[1][voiceidx]));
+		wet_l = wet_l.add32(left & GSVector4i::load<true>(&lanes.Gates[2][voiceidx]));
+		wet_r = wet_r.add32(right & GSVector4i::load<true>(&lanes.Gates[3][voiceidx]));
+	}
+
+	dest.Dry.Left += SumLanes(dry_l);
+	dest.Dry.Right += SumLanes(dry_r);
+	dest.Wet.Left += SumLanes(wet_l);
+	dest.Wet.Right += SumLanes(wet_r);
+}
+
 static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 
+	// Pitch modulation needs the previous voice's output for this sample, so it has to go one voice at a time.
+	bool modulated = false;
+	for (uint voiceidx = 1; voiceidx < V_Core::NumVoices; ++voiceidx)
+		modulated |= thiscore.Voices[voiceidx].Modulated;
+
+	if (modulated)
+	{
+		for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		{
+			StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+
+			// Note: Results from MixVoice are ranged at 16 bits.
+
+#ifdef PCSX2_DEVBUILD
+			WaveDump::WriteVoice(coreidx, voiceidx, VVal);
+#endif
+
+			dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
+			dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
+			dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
+			dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+		}
+
+		return;
+	}
+
+	VoiceLanes lanes;
+	lanes.ActiveMask = 0;
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		GatherVoice(lanes, coreidx, voiceidx);
+
+	MixVoiceLanes(dest, lanes);
+
+#ifdef PCSX2_DEVBUILD
+	// Stopped voices have no envelope, so they dump silence, same as MixVoice().
+	if (SPU2::WaveLogVoices())
+	{
+		for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+		{
+			WaveDump::WriteVoice(coreidx, voiceidx,
+				StereoOut32((lanes.Out[voiceidx] * lanes.VolumeL[voiceidx]) >> 15, (lanes.Out[voiceidx] * lanes.VolumeR[voiceidx]) >> 15));
+		}
+	}
+#endif
+
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+		// Stopped voices keep their last output for modulation.
+		if (!(lanes.ActiveMask & (1u << voiceidx)))
+			continue;
 
-		// Note: Results from MixVoice are ranged at 16 bits.
+		thiscore.Voices[voiceidx].OutX = lanes.Out[voiceidx];
 
-		dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+		if (IsDevBuild)
+			DebugCores[coreidx].Voices[voiceidx].displayPeak = std::max(DebugCores[coreidx].Voices[voiceidx].displayPeak, (s32)thiscore.Voices[voiceidx].OutX);
 	}
 }
 
@@ -9,16 +9,52 @@
 #include "common/Console.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "common/WAVWriter.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #ifdef PCSX2_DEVBUILD
 
+// Samples are queued on the mixing thread, and written out on a separate thread, so the file I/O for the dozens of
+// tracks doesn't slow down the mixer. If the writer can't keep up, samples are dropped rather than waited for.
 namespace WaveDump
 {
-	static std::unique_ptr<Common::WAVWriter> m_CoreWav[2][CoreSrc_Count];
+	static constexpr u32 RING_FRAMES = 32768;
+	static constexpr u32 RING_MASK = RING_FRAMES - 1;
+	static constexpr auto FLUSH_INTERVAL = std::chrono::milliseconds(20);
+
+	struct Track
+	{
+		std::unique_ptr<Common::WAVWriter> writer;
+		std::string filename;
+		std::unique_ptr<s16[]> ring;
+		std::atomic<u32> rpos{0};
+		std::atomic<u32> wpos{0};
+
+		// Only touched by the mixing thread while the dump is open.
+		u32 dropped_frames = 0;
+	};
+
+	static bool OpenTrack(Track& track, std::string filename);
+	static void CloseTrack(Track& track);
+	static void PushFrame(Track& track, s16 left, s16 right);
+	static void FlushTrack(Track& track);
+	static void FlushAllTracks();
+	static void WriterThreadEntryPoint();
+
+	static Track m_CoreTracks[2][CoreSrc_Count];
+	static Track m_VoiceTracks[2][V_Core::NumVoices];
+
+	static Threading::Thread s_writer_thread;
+	static std::mutex s_writer_mutex;
+	static std::condition_variable s_writer_cv;
+	static std::atomic_bool s_writer_shutdown{false};
 
 	static const char* m_tbl_CoreOutputTypeNames[CoreSrc_Count] =
 		{
@@ -29,53 +65,196 @@ namespace WaveDump
 			"PostReverb",
 			"External"};
 
+	bool OpenTrack(Track& track, std::string filename)
+	{
+		track.writer = std::make_unique<Common::WAVWriter>();
+		if (!track.writer->Open(filename.c_str(), SPU2::GetConsoleSampleRate(), 2))
+		{
+			Console.Error(fmt::format("Failed to open '{}'. Wave Log for this source disabled.", filename));
+			track.writer.reset();
+			return false;
+		}
+
+		track.filename = std::move(filename);
+
+		track.ring = std::make_unique<s16[]>(RING_FRAMES * 2);
+		track.rpos.store(0, std::memory_order_relaxed);
+		track.wpos.store(0, std::memory_order_relaxed);
+		track.dropped_frames = 0;
+		return true;
+	}
+
+	void CloseTrack(Track& track)
+	{
+		if (!track.writer)
+			return;
+
+		if (track.dropped_frames > 0)
+		{
+			Console.Warning(fmt::format("Wave Log dropped {} frames from '{}' because the writer couldn't keep up.",
+				track.dropped_frames, Path::GetFileName(track.filename)));
+		}
+
+		track.writer.reset();
+		track.filename = {};
+		track.ring.reset();
+	}
+
+	void PushFrame(Track& track, s16 left, s16 right)
+	{
+		const u32 wpos = track.wpos.load(std::memory_order_relaxed);
+		const u32 rpos = track.rpos.load(std::memory_order_acquire);
+		const u32 buffered = (wpos - rpos) & RING_MASK;
+		if (buffered == RING_MASK)
+		{
+			track.dropped_frames++;
+			return;
+		}
+
+		track.ring[wpos * 2 + 0] = left;
+		track.ring[wpos * 2 + 1] = right;
+		track.wpos.store((wpos + 1) & RING_MASK, std::memory_order_release);
+
+		// Don't wait for the timer when we're running fast enough to fill the ring before it fires.
+		if ((buffered + 1) == (RING_FRAMES / 2))
+			s_writer_cv.notify_one();
+	}
+
+	void FlushTrack(Track& track)
+	{
+		if (!track.writer)
+			return;
+
+		const u32 rpos = track.rpos.load(std::memory_order_relaxed);
+		const u32 wpos = track.wpos.load(std::memory_order_acquire);
+		if (rpos == wpos)
+			return;
+
+		if (wpos < rpos)
+		{
+			track.writer->WriteFrames(&track.ring[rpos * 2], RING_FRAMES - rpos);
+			if (wpos > 0)
+				track.writer->WriteFrames(&track.ring[0], wpos);
+		}
+		else
+		{
+			track.writer->WriteFrames(&track.ring[rpos * 2], wpos - rpos);
+		}
+
+		track.rpos.store(wpos, std::memory_order_release);
+	}
+
+	void FlushAllTracks()
+	{
+		for (uint cidx = 0; cidx < 2; cidx++)
+		{
+			for (Track& track : m_CoreTracks[cidx])
+				FlushTrack(track);
+			for (Track& track : m_VoiceTracks[cidx])
+				FlushTrack(track);
+		}
+	}
+
+	void WriterThreadEntryPoint()
+	{
+		Threading::SetNameOfCurrentThread("SPU2 Wave Log");
+
+		std::unique_lock<std::mutex> lock(s_writer_mutex);
+		for (;;)
+		{
+			s_writer_cv.wait_for(lock, FLUSH_INTERVAL, []() { return s_writer_shutdown.load(std::memory_order_acquire); });
+			const bool shutdown = s_writer_shutdown.load(std::memory_order_acquire);
+
+			lock.unlock();
+			FlushAllTracks();
+			lock.lock();
+
+			// Anything queued before the shutdown request has been written by now.
+			if (shutdown)
+				break;
+		}
+	}
+
 	void Open()
 	{
 		if (!SPU2::WaveLog())
 			return;
 
+		Close();
+
+		bool any_open = false;
 		for (uint cidx = 0; cidx < 2; cidx++)
 		{
 			for (int srcidx = 0; srcidx < CoreSrc_Count; srcidx++)
 			{
-				m_CoreWav[cidx][srcidx].reset();
+				any_open |= OpenTrack(m_CoreTracks[cidx][srcidx],
+					Path::Combine(EmuFolders::Logs, fmt::format("spu2x-Core{}d-{}.wav", cidx, m_tbl_CoreOutputTypeNames[srcidx])));
+			}
 
-				std::string wavfilename(Path::Combine(EmuFolders::Logs, fmt::format("spu2x-Core{}d-{}.wav", cidx, m_tbl_CoreOutputTypeNames[srcidx])));
-				m_CoreWav[cidx][srcidx] = std::make_unique<Common::WAVWriter>();
-				if (!m_CoreWav[cidx][srcidx]->Open(wavfilename.c_str(), SPU2::GetConsoleSampleRate(), 2))
+			if (SPU2::WaveLogVoices())
+			{
+				for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; voiceidx++)
 				{
-					Console.Error(fmt::format("Failed to open '{}'. Wave Log for this core source disabled.", wavfilename));
-					m_CoreWav[cidx][srcidx].reset();
+					any_open |= OpenTrack(m_VoiceTracks[cidx][voiceidx],
+						Path::Combine(EmuFolders::Logs, fmt::format("spu2x-Core{}d-Voice{:02}.wav", cidx, voiceidx)));
 				}
 			}
 		}
+
+		if (any_open)
+		{
+			s_writer_shutdown.store(false, std::memory_order_release);
+			s_writer_thread.Start(WriterThreadEntryPoint);
+		}
 	}
 
 	void Close()
 	{
+		if (s_writer_thread.Joinable())
+		{
+			{
+				std::unique_lock<std::mutex> lock(s_writer_mutex);
+				s_writer_shutdown.store(true, std::memory_order_release);
+				s_writer_cv.notify_one();
+			}
+
+			s_writer_thread.Join();
+		}
+
 		for (uint cidx = 0; cidx < 2; cidx++)
 		{
-			for (int srcidx = 0; srcidx < CoreSrc_Count; srcidx++)
-				m_CoreWav[cidx][srcidx].reset();
+			for (Track& track : m_CoreTracks[cidx])
+				CloseTrack(track);
+			for (Track& track : m_VoiceTracks[cidx])
+				CloseTrack(track);
 		}
 	}
 
 	void WriteCore(uint coreidx, CoreSourceType src, const StereoOut32& sample)
 	{
-		if (!m_CoreWav[coreidx][src])
+		Track& track = m_CoreTracks[coreidx][src];
+		if (!track.writer)
 			return;
 
-		const s16 frame[] = {static_cast<s16>(clamp_mix(sample.Left)), static_cast<s16>(clamp_mix(sample.Right))};
-		m_CoreWav[coreidx][src]->WriteFrames(frame, 1);
+		PushFrame(track, static_cast<s16>(clamp_mix(sample.Left)), static_cast<s16>(clamp_mix(sample.Right)));
 	}
 
 	void WriteCore(uint coreidx, CoreSourceType src, s16 left, s16 right)
 	{
-		if (!m_CoreWav[coreidx][src])
+		Track& track = m_CoreTracks[coreidx][src];
+		if (!track.writer)
+			return;
+
+		PushFrame(track, left, right);
+	}
+
+	void WriteVoice(uint coreidx, uint voiceidx, const StereoOut32& sample)
+	{
+		Track& track = m_VoiceTracks[coreidx][voiceidx];
+		if (!track.writer)
 			return;
 
-		const s16 frame[] = {left, right};
-		m_CoreWav[coreidx][src]->WriteFrames(frame, 1);
+		PushFrame(track, static_cast<s16>(clamp_mix(sample.Left)), static_cast<s16>(clamp_mix(sample.Right)));
 	}
 } // namespace WaveDump
 
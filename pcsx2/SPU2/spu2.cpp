@@ -62,6 +62,8 @@ void SPU2writeDMA4Mem(u16* pMem, u32 size) // size now in 16bit units
 
 void SPU2interruptDMA4()
 {
+	SPU2_WaitForMixThread();
+
 	SPU2::FileLog("[%10d] SPU2 interruptDMA4\n", Cycles);
 	if (Cores[0].DmaMode)
 		Cores[0].Regs.STATX |= 0x80;
@@ -71,6 +73,8 @@ void SPU2interruptDMA4()
 
 void SPU2interruptDMA7()
 {
+	SPU2_WaitForMixThread();
+
 	SPU2::FileLog("[%10d] SPU2 interruptDMA7\n", Cycles);
 	if (Cores[1].DmaMode)
 		Cores[1].Regs.STATX |= 0x80;
@@ -177,6 +181,7 @@ void SPU2::InternalReset(bool psxmode)
 {
 	s_current_chunk_pos = 0;
 	s_psxmode = psxmode;
+	SPU2_ResetDeferredWrites();
 	if (!s_psxmode)
 	{
 		memset(spu2regs, 0, 0x010000);
@@ -204,6 +209,7 @@ void SPU2::OnTargetSpeedChanged()
 
 	if (!s_output_stream->IsStretchEnabled())
 	{
+		SPU2_WaitForMixThread();
 		s_output_stream->EmptyBuffer();
 		s_current_chunk_pos = 0;
 	}
@@ -241,6 +247,8 @@ bool SPU2::Open()
 
 void SPU2::Close()
 {
+	SPU2_ShutdownMixThread();
+
 	FileLog("[%10d] SPU2 Close\n", Cycles);
 
 	s_output_stream.reset();
@@ -264,6 +272,12 @@ void SPU2::CheckForConfigChanges(const Pcsx2Config& old_config)
 	const Pcsx2Config::SPU2Options& opts = EmuConfig.SPU2;
 	const Pcsx2Config::SPU2Options& oldopts = old_config.SPU2;
 
+	// The mixer thread could be writing to the output stream.
+	if (opts.ThreadedMixing)
+		SPU2_WaitForMixThread();
+	else
+		SPU2_ShutdownMixThread();
+
 	// No need to reinit for volume change.
 	if ((opts.OutputVolume != oldopts.OutputVolume && VMManager::GetTargetSpeed() == 1.0f) ||
 		(opts.FastForwardVolume != oldopts.FastForwardVolume && VMManager::GetTargetSpeed() != 1.0f) ||
@@ -299,7 +313,7 @@ void SPU2::CheckForConfigChanges(const Pcsx2Config& old_config)
 
 void SPU2async()
 {
-	TimeUpdate(psxRegs.cycle);
+	TimeUpdate(psxRegs.cycle, true);
 }
 
 u16 SPU2read(u32 rmem)
@@ -360,16 +374,23 @@ void SPU2write(u32 rmem, u16 value)
 	// If the SPU2 isn't in in sync with the IOP, samples can end up playing at rather
 	// incorrect pitches and loop lengths.
 
-	TimeUpdate(psxRegs.cycle);
-
 	if (rmem >> 16 == 0x1f80)
+	{
+		TimeUpdate(psxRegs.cycle);
 		Cores[0].WriteRegPS1(rmem, value);
+	}
 	else
 	{
+		TimeUpdate(psxRegs.cycle, true);
+
 #ifdef PCSX2_DEVBUILD
 		SPU2::WriteRegLog("write", rmem, value);
 #endif
-		SPU2_FastWrite(rmem, value);
+		if (!SPU2_DeferWrite(rmem, value))
+		{
+			TimeUpdate(psxRegs.cycle);
+			SPU2_FastWrite(rmem, value);
+		}
 	}
 }
 
@@ -401,8 +422,10 @@ s32 SPU2freeze(FreezeAction mode, freezeData* data)
 	switch (mode)
 	{
 		case FreezeAction::Load:
+			SPU2_ResetDeferredWrites();
 			return SPU2Savestate::ThawIt(spud);
 		case FreezeAction::Save:
+			TimeUpdate(psxRegs.cycle);
 			return SPU2Savestate::FreezeIt(spud);
 
 			jNO_DEFAULT;
@@ -71,7 +71,17 @@ void SPU2writeDMA7Mem(u16* pMem, u32 size);
 
 extern u32 lClocks;
 
-extern void TimeUpdate(u32 cClocks);
+extern void TimeUpdate(u32 cClocks, bool allow_defer = false);
 extern void SPU2_FastWrite(u32 rmem, u16 value);
 
+/// Queues a register write to be replayed once the mixer catches up, if block mixing is lagging behind.
+/// Returns false if the write has to be made immediately, after a TimeUpdate().
+extern bool SPU2_DeferWrite(u32 rmem, u16 value);
+extern void SPU2_ResetDeferredWrites();
+
+/// Waits for the block being mixed on the mixer thread, if any. Must be called before touching SPU2 state
+/// from outside the IOP's register/DMA handlers, which already do so.
+extern void SPU2_WaitForMixThread();
+extern void SPU2_ShutdownMixThread();
+
 //#define PCM24_S1_INTERLEAVE
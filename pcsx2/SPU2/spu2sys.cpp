@@ -18,6 +18,11 @@
 #include "SPU2/spu2.h"
 
 #include "common/Console.h"
+#include "common/FPControl.h"
+#include "common/Threading.h"
+
+#include <array>
+#include <atomic>
 
 s16 spu2regs[0x010000 / sizeof(s16)];
 s16 _spu2mem[0x200000 / sizeof(s16)];
@@ -219,6 +224,131 @@ void V_Voice::Stop()
 static constexpr uint TickInterval = 768;
 static constexpr int SanityInterval = 4800;
 
+// Block mixing: while nothing the IOP can see depends on the mixer's progress, the mixer is allowed
+// to lag behind the IOP by up to MixBlockSize samples. Register writes made in the meantime are queued
+// with the cycle they happened on, and replayed in between the same samples they would have landed
+// between when mixing one sample at a time, so the output is unchanged. Any register read or DMA
+// brings the mixer up to date first.
+//
+// With threaded mixing, each block is handed to the mixer thread along with its writes, and the IOP
+// carries on queueing writes for the next one. Anything which needs the mixer to be up to date waits
+// for the mixer thread first, see SPU2_WaitForMixThread().
+static constexpr uint MixBlockSize = 64;
+static constexpr uint MaxDeferredWrites = 512;
+
+struct DeferredWrite
+{
+	u32 cycle;
+	u32 rmem;
+	u16 value;
+};
+
+struct MixBlock
+{
+	std::array<DeferredWrite, MaxDeferredWrites> writes;
+	u32 num_writes;
+	u32 next_write;
+
+	// Set when the block is handed to the mixer thread.
+	u32 start_clock;
+	u32 ticks;
+};
+
+static MixBlock s_mix_blocks[2];
+static MixBlock* s_pending_block = &s_mix_blocks[0];
+
+static Threading::Thread s_mix_thread;
+static Threading::WorkSema s_mix_thread_sema;
+static std::atomic_bool s_mix_thread_shutdown{false};
+static MixBlock* s_mix_thread_block = nullptr;
+
+// Only accessed on the thread running the IOP.
+static bool s_mix_thread_busy = false;
+
+static bool CanDeferMixing()
+{
+	// Nothing which affects this can change until the mixer thread has been waited for.
+	if (s_mix_thread_busy)
+		return true;
+
+	if (!EmuConfig.SPU2.BlockMixing || SPU2::IsRunningPSXMode())
+		return false;
+
+	// IRQs and DMAs raised by the mixer have to be delivered on time.
+	for (int i = 0; i < 2; i++)
+	{
+		const V_Core& core = Cores[i];
+		if (core.IRQEnable || has_to_call_irq[i] || has_to_call_irq_dma[i] || core.DMAICounter > 0 ||
+			core.AdmaInProgress || core.InputDataLeft > 0 || core.InputDataTransferred > 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool CanDeferWrite(u32 rmem)
+{
+	// PS1 and SPDIF/global registers.
+	const u32 mem = rmem & 0xFFFF;
+	if ((rmem >> 16) == 0x1f80 || mem >= 0x760)
+		return false;
+
+	// Can enable IRQs or start DMAs.
+	const u32 omem = mem & ~0x400u;
+	return (omem != REG_C_ATTR && omem != REG_S_ADMAS);
+}
+
+bool SPU2_DeferWrite(u32 rmem, u16 value)
+{
+	MixBlock& block = *s_pending_block;
+
+	// Nothing to defer if the mixer is up to date.
+	if (block.num_writes == 0 && (psxRegs.cycle - lClocks) < TickInterval && !s_mix_thread_busy)
+		return false;
+
+	if (block.num_writes == MaxDeferredWrites || !CanDeferWrite(rmem) || !CanDeferMixing())
+		return false;
+
+	block.writes[block.num_writes++] = {psxRegs.cycle, rmem, value};
+	return true;
+}
+
+void SPU2_ResetDeferredWrites()
+{
+	SPU2_WaitForMixThread();
+
+	s_pending_block->num_writes = 0;
+	s_pending_block->next_write = 0;
+}
+
+// Replays the queued writes which were made before the mixer reached the specified cycle.
+static void ReplayDeferredWrites(MixBlock& block, u32 before_cycle)
+{
+	while (block.next_write < block.num_writes)
+	{
+		const DeferredWrite& write = block.writes[block.next_write];
+		if (static_cast<s32>(write.cycle - before_cycle) >= 0)
+			return;
+
+		block.next_write++;
+		SPU2_FastWrite(write.rmem, write.value);
+	}
+}
+
+static void ReplayAllDeferredWrites(MixBlock& block)
+{
+	while (block.next_write < block.num_writes)
+	{
+		const DeferredWrite& write = block.writes[block.next_write++];
+		SPU2_FastWrite(write.rmem, write.value);
+	}
+
+	block.num_writes = 0;
+	block.next_write = 0;
+}
+
 __forceinline static bool StartQueuedVoice(uint coreidx, uint voiceidx)
 {
 	V_Voice& vc(Cores[coreidx].Voices[voiceidx]);
@@ -254,32 +384,14 @@ __forceinline static bool StartQueuedVoice(uint coreidx, uint voiceidx)
 	return true;
 }
 
-__forceinline void TimeUpdate(u32 cClocks)
+// Mixes the specified number of samples, starting at clock, replaying the block's writes in between.
+static void RunTicks(MixBlock& block, u32 clock, u32 ticks)
 {
-	u32 dClocks = cClocks - lClocks;
-
-	// Sanity Checks:
-	//  It's not totally uncommon for the IOP's clock to jump backwards a cycle or two, and in
-	//  such cases we just want to ignore the TimeUpdate call.
-
-	if (dClocks > (u32)-15)
-		return;
-
-	//  But if for some reason our clock value seems way off base (typically due to bad dma
-	//  timings from PCSX2), just mix out a little bit, skip the rest, and hope the ship
-	//  "rights" itself later on.
-
-	if (dClocks > static_cast<u32>(TickInterval * SanityInterval))
+	for (; ticks > 0; ticks--)
 	{
-		if (SPU2::MsgToConsole())
-			SPU2::ConLog(" * SPU2 > TimeUpdate Sanity Check (Tick Delta: %d) (PS2 Ticks: %d)\n", dClocks / TickInterval, cClocks / TickInterval);
-		dClocks = TickInterval * SanityInterval;
-		lClocks = cClocks - dClocks;
-	}
+		if (block.num_writes > 0)
+			ReplayDeferredWrites(block, clock + TickInterval);
 
-	//Update Mixing Progress
-	while (dClocks >= TickInterval)
-	{
 		for (int i = 0; i < 2; i++)
 		{
 			if (has_to_call_irq[i])
@@ -294,8 +406,7 @@ __forceinline void TimeUpdate(u32 cClocks)
 			}
 		}
 
-		dClocks -= TickInterval;
-		lClocks += TickInterval;
+		clock += TickInterval;
 		Cycles++;
 
 		// Start Queued Voices, they start after 2T (Tested on real HW)
@@ -307,6 +418,123 @@ __forceinline void TimeUpdate(u32 cClocks)
 
 		spu2Mix();
 	}
+}
+
+static void MixThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("SPU2 Mixer");
+
+	for (;;)
+	{
+		s_mix_thread_sema.WaitForWork();
+		if (s_mix_thread_shutdown.load(std::memory_order_acquire))
+			break;
+
+		// Reverb resampling is in floating point, keep it rounding the same way as on the IOP's thread.
+		FPControlRegister::SetCurrent(EmuConfig.Cpu.FPUFPCR);
+
+		MixBlock& block = *s_mix_thread_block;
+		RunTicks(block, block.start_clock, block.ticks);
+		ReplayAllDeferredWrites(block);
+	}
+
+	s_mix_thread_sema.Kill();
+}
+
+// Hands the pending writes and the next ticks worth of samples to the mixer thread.
+static void DispatchMixBlock(u32 ticks)
+{
+	SPU2_WaitForMixThread();
+
+	if (!s_mix_thread.Joinable())
+	{
+		s_mix_thread_sema.Reset();
+		s_mix_thread_shutdown.store(false, std::memory_order_release);
+		s_mix_thread.Start(&MixThreadEntryPoint);
+	}
+
+	MixBlock* block = s_pending_block;
+	block->start_clock = lClocks;
+	block->ticks = ticks;
+	lClocks += ticks * TickInterval;
+
+	s_pending_block = (block == &s_mix_blocks[0]) ? &s_mix_blocks[1] : &s_mix_blocks[0];
+	s_mix_thread_block = block;
+	s_mix_thread_busy = true;
+	s_mix_thread_sema.NotifyOfWork();
+}
+
+void SPU2_WaitForMixThread()
+{
+	if (!s_mix_thread_busy)
+		return;
+
+	s_mix_thread_sema.WaitForEmptyWithSpin();
+	s_mix_thread_busy = false;
+}
+
+void SPU2_ShutdownMixThread()
+{
+	if (!s_mix_thread.Joinable())
+		return;
+
+	SPU2_WaitForMixThread();
+	s_mix_thread_shutdown.store(true, std::memory_order_release);
+	s_mix_thread_sema.NotifyOfWork();
+	s_mix_thread.Join();
+}
+
+__forceinline void TimeUpdate(u32 cClocks, bool allow_defer)
+{
+	u32 dClocks = cClocks - lClocks;
+
+	// Sanity Checks:
+	//  It's not totally uncommon for the IOP's clock to jump backwards a cycle or two, and in
+	//  such cases we just want to ignore the TimeUpdate call.
+
+	if (dClocks > (u32)-15)
+	{
+		if (!allow_defer)
+		{
+			SPU2_WaitForMixThread();
+			ReplayAllDeferredWrites(*s_pending_block);
+		}
+		return;
+	}
+
+	if (allow_defer && CanDeferMixing())
+	{
+		if (dClocks < (TickInterval * MixBlockSize))
+			return;
+
+		if (EmuConfig.SPU2.ThreadedMixing)
+		{
+			DispatchMixBlock(dClocks / TickInterval);
+			return;
+		}
+	}
+
+	SPU2_WaitForMixThread();
+
+	//  But if for some reason our clock value seems way off base (typically due to bad dma
+	//  timings from PCSX2), just mix out a little bit, skip the rest, and hope the ship
+	//  "rights" itself later on.
+
+	if (dClocks > static_cast<u32>(TickInterval * SanityInterval))
+	{
+		if (SPU2::MsgToConsole())
+			SPU2::ConLog(" * SPU2 > TimeUpdate Sanity Check (Tick Delta: %d) (PS2 Ticks: %d)\n", dClocks / TickInterval, cClocks / TickInterval);
+		dClocks = TickInterval * SanityInterval;
+		lClocks = cClocks - dClocks;
+	}
+
+	//Update Mixing Progress
+	const u32 ticks = dClocks / TickInterval;
+	RunTicks(*s_pending_block, lClocks, ticks);
+	lClocks += ticks * TickInterval;
+
+	if (s_pending_block->num_writes > 0)
+		ReplayAllDeferredWrites(*s_pending_block);
 
 	//Update DMA4 interrupt delay counter
 	if (Cores[0].DMAICounter > 0 && (psxRegs.cycle - Cores[0].LastClock) > 0)
@@ -12,7 +12,9 @@
 #include "GS.h"
 #include "GS/GS.h"
 #include "Host.h"
+#include "IPU/IPU_Thread.h"
 #include "MTGS.h"
+#include "MTIOP.h"
 #include "MTVU.h"
 #include "SIO/Pad/Pad.h"
 #include "Patch.h"
@@ -50,6 +52,8 @@ static void PreLoadPrep()
 	// ensure everything is in sync before we start overwriting stuff.
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
+	iopThread.WaitIOP();
+	ipuThread.WaitIPU();
 	MTGS::WaitGS(false);
 
 	// backup current TLBs, since we're going to overwrite them all
@@ -73,6 +77,7 @@ static void PostLoadPrep()
 			MapTLB(tlb[i], i);
 		}
 	}
+	vtlb_UpdateCacheMap();
 
 	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
 	CBreakPoints::SetSkipFirst(BREAKPOINT_EE, 0);
@@ -185,6 +190,13 @@ bool SaveStateBase::FreezeInternals(Error* error)
 	Freeze(AllowParams1);	//OSDConfig written (Fast Boot)
 	Freeze(AllowParams2);
 
+	if (IsLoading())
+	{
+		// The event queues aren't saved, they're derived from the pending interrupt masks.
+		cpuRebuildEventQueue();
+		psxRebuildEventQueue();
+	}
+
 	// Third Block - Cycle Timers and Events
 	// -------------------------------------
 	if (!FreezeTag("Cycles"))
@@ -700,6 +712,9 @@ static const std::unique_ptr<BaseSavestateEntry> SavestateEntries[] = {
 
 std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 {
+	iopThread.WaitIOP();
+	ipuThread.WaitIPU();
+
 	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>();
 	destlist->GetBuffer().resize(1024 * 1024 * 64);
 
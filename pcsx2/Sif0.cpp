@@ -7,6 +7,7 @@
 #include "Common.h"
 #include "Sif.h"
 #include "IopHw.h"
+#include "MTIOP.h"
 
 _sif sif0;
 
@@ -342,6 +343,8 @@ __fi void  EEsif0Interrupt()
 
 __fi void dmaSIF0()
 {
+	iopThread.WaitIOP();
+
 	SIF_LOG("dmaSIF0 %s", sif0ch.cmqt_to_str().c_str());
 
 	if (sif0.fifo.readPos != sif0.fifo.writePos)
@@ -7,6 +7,7 @@
 #include "Common.h"
 #include "Sif.h"
 #include "IopHw.h"
+#include "MTIOP.h"
 
 _sif sif1;
 
@@ -318,6 +319,8 @@ __fi void  EEsif1Interrupt()
 // Main difference is this checks for iop, where psxDma10 checks for ee.
 __fi void dmaSIF1()
 {
+	iopThread.WaitIOP();
+
 	SIF_LOG("dmaSIF1 %s", sif1ch.cmqt_to_str().c_str());
 
 	if (sif1.fifo.readPos != sif1.fifo.writePos)
@@ -7,6 +7,7 @@
 #include "Counters.h"
 #include "DEV9/DEV9.h"
 #include "DebugTools/DebugInterface.h"
+#include "DebugTools/GuestProfiler.h"
 #include "DebugTools/SymbolGuardian.h"
 #include "Elfheader.h"
 #include "FW.h"
@@ -17,11 +18,13 @@
 #include "GameList.h"
 #include "Host.h"
 #include "INISettingsInterface.h"
+#include "IPU/IPU_Thread.h"
 #include "ImGui/FullscreenUI.h"
 #include "ImGui/ImGuiOverlays.h"
 #include "Input/InputManager.h"
 #include "IopBios.h"
 #include "MTGS.h"
+#include "MTIOP.h"
 #include "MTVU.h"
 #include "PINE.h"
 #include "Patch.h"
@@ -271,6 +274,8 @@ void VMManager::SetState(VMState state)
 		{
 			if (THREAD_VU1)
 				vu1Thread.WaitVU();
+			iopThread.WaitIOP();
+			ipuThread.WaitIPU();
 			MTGS::WaitGS(false);
 			InputManager::PauseVibration();
 		}
@@ -639,9 +644,13 @@ void VMManager::LoadCoreSettings(SettingsInterface& si)
 	EmuConfig.GS.MaskUserHacks();
 	EmuConfig.GS.MaskUpscalingHacks();
 
-	// Force MTVU off when playing back GS dumps, it doesn't get used.
+	// Force MTVU and the IOP and IPU threads off when playing back GS dumps, they don't get used.
 	if (GSDumpReplayer::IsReplayingDump())
+	{
 		EmuConfig.Speedhacks.vuThread = false;
+		EmuConfig.Speedhacks.iopThread = false;
+		EmuConfig.Speedhacks.ipuThread = false;
+	}
 }
 
 void VMManager::LoadInputBindings(SettingsInterface& si, std::unique_lock<std::mutex>& lock)
@@ -701,6 +710,8 @@ void VMManager::ApplySettings()
 	{
 		if (THREAD_VU1)
 			vu1Thread.WaitVU();
+		iopThread.WaitIOP();
+		ipuThread.WaitIPU();
 		MTGS::WaitGS(false);
 	}
 
@@ -724,6 +735,8 @@ void VMManager::ApplyCoreSettings()
 	{
 		if (THREAD_VU1)
 			vu1Thread.WaitVU();
+		iopThread.WaitIOP();
+		ipuThread.WaitIPU();
 		MTGS::WaitGS(false);
 	}
 
@@ -1464,6 +1477,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 	FPControlRegister::SetCurrent(EmuConfig.Cpu.FPUFPCR);
 	memBindConditionalHandlers();
 	SysMemory::Reset();
+	vu1Thread.Reset();
 	cpuReset();
 
 	Console.WriteLn("Opening GS...");
@@ -1596,6 +1610,8 @@ void VMManager::Shutdown(bool save_resume_state)
 	// sync everything
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
+	iopThread.WaitIOP();
+	ipuThread.WaitIPU();
 	MTGS::WaitGS();
 
 	if (!GSDumpReplayer::IsReplayingDump() && save_resume_state)
@@ -1609,6 +1625,10 @@ void VMManager::Shutdown(bool save_resume_state)
 	if (g_InputRecording.isActive())
 		g_InputRecording.stop();
 
+	// write out the profile before the disc serial is cleared
+	if (GuestProfiler::IsActive())
+		GuestProfiler::Stop();
+
 	SaveSessionTime(s_disc_serial);
 	s_elf_override = {};
 	ClearELFInfo();
@@ -1699,6 +1719,8 @@ void VMManager::Reset()
 
 	vu1Thread.WaitVU();
 	vu1Thread.Reset();
+	iopThread.WaitIOP();
+	ipuThread.WaitIPU();
 	MTGS::WaitGS();
 
 	const bool elf_was_changed = (s_current_crc != 0);
@@ -2570,6 +2592,9 @@ void VMManager::InitializeCPUProviders()
 
 void VMManager::ShutdownCPUProviders()
 {
+	iopThread.Close();
+	ipuThread.Close();
+
 	if (newVifDynaRec)
 	{
 		dVifRelease(1);
@@ -2645,6 +2670,10 @@ void VMManager::Execute()
 
 	// Execute until we're asked to stop.
 	Cpu->Execute();
+
+	// The EE can stop in the middle of an IOP slice or IPU command, don't leave them running while we're paused.
+	iopThread.WaitIOP();
+	ipuThread.WaitIPU();
 }
 
 void VMManager::IdlePollUpdate()
@@ -3107,6 +3136,8 @@ void VMManager::WarnAboutUnsafeSettings()
 
 	if (EmuConfig.Speedhacks.fastCDVD)
 		append(ICON_FA_COMPACT_DISC, TRANSLATE_SV("VMManager", "Fast CDVD is enabled, this may break games."));
+	if (EmuConfig.Speedhacks.fastLoad)
+		append(ICON_FA_COMPACT_DISC, TRANSLATE_SV("VMManager", "Adaptive Fast Loading is enabled, this may break games."));
 	if (EmuConfig.Speedhacks.EECycleRate != 0 || EmuConfig.Speedhacks.EECycleSkip != 0)
 	{
 		append(ICON_FA_TACHOMETER_ALT,
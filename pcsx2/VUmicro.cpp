@@ -6,6 +6,7 @@
 #include "MTVU.h"
 #include "GS.h"
 #include "Gif_Unit.h"
+#include "DebugTools/GuestProfiler.h"
 
 BaseVUmicroCPU* CpuVU0 = nullptr;
 BaseVUmicroCPU* CpuVU1 = nullptr;
@@ -23,6 +24,21 @@ __inline u32 CalculateMinRunCycles(u32 cycles, bool requiresAccurateCycles)
 	return std::max(16U, cycles);
 }
 
+static void ExecuteAndProfile(BaseVUmicroCPU* cpu, VURegs& regs, u32 cycles)
+{
+	if (!GuestProfiler::IsActive())
+	{
+		cpu->Execute(cycles);
+		return;
+	}
+
+	const u32 start_pc = regs.start_pc;
+	const u32 start_cycle = regs.cycle;
+	cpu->Execute(cycles);
+	GuestProfiler::Record(regs.IsVU1() ? GuestProfiler::Source::VU1 : GuestProfiler::Source::VU0, start_pc,
+		regs.cycle - start_cycle);
+}
+
 // Executes a Block based on EE delta time
 void BaseVUmicroCPU::ExecuteBlock(bool startUp)
 {
@@ -45,17 +61,17 @@ void BaseVUmicroCPU::ExecuteBlock(bool startUp)
 		return;
 	}
 
+	VURegs& regs = m_Idx ? VU1 : VU0;
 	if (startUp)
 	{
-		Execute(CalculateMinRunCycles(0, false));
+		ExecuteAndProfile(this, regs, CalculateMinRunCycles(0, false));
 	}
 	else // Continue Executing
 	{
-		u32 cycle = m_Idx ? VU1.cycle : VU0.cycle;
-		s32 delta = (s32)(u32)(cpuRegs.cycle - cycle);
+		s32 delta = (s32)(u32)(cpuRegs.cycle - regs.cycle);
 
 		if (delta > 0)
-			Execute(CalculateMinRunCycles(delta, false));
+			ExecuteAndProfile(this, regs, CalculateMinRunCycles(delta, false));
 	}
 }
 
@@ -74,7 +90,7 @@ void BaseVUmicroCPU::ExecuteBlockJIT(BaseVUmicroCPU* cpu, bool interlocked)
 
 		if (delta > 0)
 		{
-			cpu->Execute(CalculateMinRunCycles(delta, interlocked)); // Execute the time since the last call
+			ExecuteAndProfile(cpu, VU0, CalculateMinRunCycles(delta, interlocked)); // Execute the time since the last call
 		}
 	}
 }
@@ -31,7 +31,7 @@ struct nVifStruct
 	u8*                     recWritePtr; // current write pos into the reserve
 	u8*                     recEndPtr;
 
-	HashBucket              vifBlocks;   // Vif Blocks
+	nVifBlockTable          vifBlocks;   // Vif Blocks
 
 
 	nVifStruct() = default;
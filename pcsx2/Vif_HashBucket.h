@@ -3,12 +3,16 @@
 
 #pragma once
 
-#include <array>
-#include "fmt/core.h"
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
+#include "common/VectorIntrin.h"
 
-// nVifBlock - Ordered for Hashing; the 'num' and 'upkType' fields are
-//             used as the hash bucket selector.
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+// nVifBlock - Ordered for Hashing; the 'num', 'upkType', 'mask' and the
+//             mode/alignment/cycle fields make up the lookup key.
 union nVifBlock
 {
 	// Warning: order depends on the newVifDynaRec code
@@ -34,103 +38,180 @@ union nVifBlock
 		uptr value;
 	};
 
-}; // 16 bytes
+}; // 24 bytes
 
-// 0x4000 is enough but 0x10000 allow
-// * to skip the compare value of the first double world in lookup
-// * to use a 16 bits move instead of an 'and' mask to compute the hashed key
-#define hSize 0x10000 // [usn*1:mask*1:upk*4:num*8] hash...
+static_assert(offsetof(nVifBlock, key0) == 4 && offsetof(nVifBlock, key1) == 8 && offsetof(nVifBlock, value) == 16,
+	"nVifBlock key layout must match the lookup compare");
 
-// HashBucket is a container which uses a built-in hash function
-// to perform quick searches. It is designed around the nVifBlock structure
+// nVifBlockTable is an open-addressing (linear probing) hash table of nVifBlocks.
 //
-// The hash function is determined by taking the first bytes of data and
-// performing a modulus the size of hSize. So the most diverse-data should
-// be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
-class HashBucket
+// Every slot is 32 bytes and the table is 64 byte aligned, so a lookup touches a single cache
+// line in the common case, and the key (hash_key/key0/key1) is compared in one go with a masked
+// 16 byte vector compare. A zero startPtr marks an empty slot. The table grows once it is 3/4
+// full, so pointers returned by find() are only valid until the next add().
+class nVifBlockTable
 {
-protected:
-	std::array<nVifBlock*, hSize> m_bucket;
+	struct alignas(32) Slot
+	{
+		nVifBlock block;
+	};
 
-public:
-	HashBucket()
+	static constexpr u32 INITIAL_CAPACITY = 1024;
+
+	Slot* m_slots = nullptr;
+	u32 m_capacity = 0;
+	u32 m_count = 0;
+
+	// Statistics, reported when the table is cleared.
+	u64 m_lookups = 0;
+	u64 m_hits = 0;
+	u64 m_probes = 0;
+	u32 m_max_probe = 0;
+
+#if defined(_M_X86)
+	using KeyVector = __m128i;
+
+	static __fi KeyVector make_key(const nVifBlock& key)
 	{
-		m_bucket.fill(nullptr);
+		return _mm_setr_epi32(key.hash_key, key.key0, key.key1, 0);
 	}
 
-	~HashBucket() { clear(); }
-
-	__fi nVifBlock* find(const nVifBlock& dataPtr)
+	static __fi bool key_equals(const Slot& slot, const KeyVector& key)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		// Mask out 'length' (upper half of the first dword) and the padding before startPtr.
+		const __m128i keymask = _mm_setr_epi32(0xFFFF, -1, -1, 0);
+		const __m128i data = _mm_and_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(&slot)), keymask);
+		return (_mm_movemask_epi8(_mm_cmpeq_epi32(data, key)) == 0xFFFF);
+	}
+#elif defined(_M_ARM64)
+	using KeyVector = uint32x4_t;
 
-		while (true)
-		{
-			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
-				return chainpos;
+	static __fi KeyVector make_key(const nVifBlock& key)
+	{
+		const u32 values[4] = {key.hash_key, key.key0, key.key1, 0};
+		return vld1q_u32(values);
+	}
 
-			if (chainpos->startPtr == 0)
-				return nullptr;
+	static __fi bool key_equals(const Slot& slot, const KeyVector& key)
+	{
+		static constexpr u32 mask_values[4] = {0xFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0};
+		const uint32x4_t data = vandq_u32(vld1q_u32(reinterpret_cast<const u32*>(&slot)), vld1q_u32(mask_values));
+		return (vminvq_u32(vceqq_u32(data, key)) == 0xFFFFFFFFu);
+	}
+#endif
 
-			chainpos++;
-		}
+	static __fi u32 hash(const nVifBlock& key)
+	{
+		// hash_key alone (num/upkType) would pile every mask/cycle variant into the same run.
+		u32 h = (static_cast<u32>(key.hash_key) * 0x9E3779B1u) ^ (key.key0 * 0x85EBCA77u) ^ (key.key1 * 0xC2B2AE3Du);
+		h ^= h >> 15;
+		return h;
 	}
 
-	void add(const nVifBlock& dataPtr)
+	void allocate(u32 capacity)
 	{
-		u32 b = dataPtr.hash_key;
+		m_slots = static_cast<Slot*>(_aligned_malloc(sizeof(Slot) * capacity, 64));
+		if (!m_slots)
+			pxFailRel("Failed to allocate nVif block table");
 
-		u32 size = bucket_size(dataPtr);
+		std::memset(static_cast<void*>(m_slots), 0, sizeof(Slot) * capacity);
+		m_capacity = capacity;
+		m_count = 0;
+	}
 
-		// Warning there is an extra +1 due to the empty cell
-		// Performance note: 64B align to reduce cache miss penalty in `find`
-		if ((m_bucket[b] = (nVifBlock*)pcsx2_aligned_realloc(m_bucket[b], sizeof(nVifBlock) * (size + 2), 64, sizeof(nVifBlock) * (size + 1))) == NULL)
+	void insert(const nVifBlock& block)
+	{
+		const u32 mask = m_capacity - 1;
+		u32 pos = hash(block) & mask;
+		u32 probes = 1;
+		while (m_slots[pos].block.value != 0)
 		{
-			pxFailRel("Failed to allocate HashBucket Chain");
+			pos = (pos + 1) & mask;
+			probes++;
 		}
 
-		// Replace the empty cell by the new block and create a new empty cell
-		memcpy(&m_bucket[b][size++], &dataPtr, sizeof(nVifBlock));
-		memset(&m_bucket[b][size], 0, sizeof(nVifBlock));
-
-		if (size > 3)
-			DevCon.Warning("recVifUnpk: Bucket 0x%04x has %d micro-programs", b, size);
+		std::memcpy(&m_slots[pos].block, &block, sizeof(nVifBlock));
+		m_count++;
+		m_max_probe = std::max(m_max_probe, probes);
 	}
 
-	u32 bucket_size(const nVifBlock& dataPtr)
+	void grow()
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		Slot* old_slots = m_slots;
+		const u32 old_capacity = m_capacity;
 
-		u32 size = 0;
-
-		while (chainpos->startPtr != 0)
+		allocate(old_capacity * 2);
+		m_max_probe = 0;
+		for (u32 i = 0; i < old_capacity; i++)
 		{
-			size++;
-			chainpos++;
+			if (old_slots[i].block.value != 0)
+				insert(old_slots[i].block);
 		}
 
-		return size;
+		_aligned_free(old_slots);
 	}
 
-	void clear()
-	{
-		for (auto& bucket : m_bucket)
-			safe_aligned_free(bucket);
-	}
+public:
+	nVifBlockTable() = default;
+	~nVifBlockTable() { safe_aligned_free(m_slots); }
 
-	void reset()
+	__fi nVifBlock* find(const nVifBlock& dataPtr)
 	{
-		clear();
+		const KeyVector key = make_key(dataPtr);
+		const u32 mask = m_capacity - 1;
+		u32 pos = hash(dataPtr) & mask;
 
-		// Allocate an empty cell for all buckets
-		for (auto& bucket : m_bucket)
+		m_lookups++;
+		for (u32 probes = 1;; probes++)
 		{
-			if ((bucket = (nVifBlock*)_aligned_malloc(sizeof(nVifBlock), 16)) == nullptr)
+			Slot& slot = m_slots[pos];
+			if (slot.block.value == 0)
 			{
-				pxFailRel("Failed to allocate HashBucket Chain on reset");
+				m_probes += probes;
+				return nullptr;
 			}
 
-			memset(bucket, 0, sizeof(nVifBlock));
+			if (key_equals(slot, key))
+			{
+				m_hits++;
+				m_probes += probes;
+				return &slot.block;
+			}
+
+			pos = (pos + 1) & mask;
+		}
+	}
+
+	void add(const nVifBlock& dataPtr)
+	{
+		pxAssert(dataPtr.value != 0);
+		if ((m_count + 1) * 4 > m_capacity * 3)
+			grow();
+
+		insert(dataPtr);
+	}
+
+	void clear()
+	{
+		if (m_lookups > 0)
+		{
+			DevCon.WriteLn("nVif block table: %u blocks, %.2f%% hits, %.2f avg probes, %u max probes",
+				m_count, static_cast<double>(m_hits) * 100.0 / static_cast<double>(m_lookups),
+				static_cast<double>(m_probes) / static_cast<double>(m_lookups), m_max_probe);
 		}
+
+		safe_aligned_free(m_slots);
+		m_capacity = 0;
+		m_count = 0;
+		m_lookups = 0;
+		m_hits = 0;
+		m_probes = 0;
+		m_max_probe = 0;
+	}
+
+	void reset()
+	{
+		clear();
+		allocate(INITIAL_CAPACITY);
 	}
 };
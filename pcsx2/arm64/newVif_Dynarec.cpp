@@ -508,7 +508,7 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 	nVifBlock block;
 
 	// Performance note: initial code was using u8/u16 field of the struct
-	// directly. However reading back the data (as u32) in HashBucket.find
+	// directly. However reading back the data (as u32) in nVifBlockTable.find
 	// leads to various memory stalls. So it is way faster to manually build the data
 	// in u32 (aka x86 register).
 	//
@@ -7,6 +7,7 @@
 #include "Common.h"
 #include "Sif.h"
 #include "IopHw.h"
+#include "MTIOP.h"
 
 _sif sif2;
 
@@ -357,6 +358,8 @@ __fi void  EEsif2Interrupt()
 
 __fi void dmaSIF2()
 {
+	iopThread.WaitIOP();
+
 	DevCon.Warning("SIF2 EE CHCR %x", sif2dma.chcr._u32);
 	SIF_LOG("dmaSIF2%s", sif2dma.cmqt_to_str().c_str());
 
@@ -83,6 +83,9 @@ static std::unordered_multimap<u32, u32> s_fastmem_physical_mapping; // maps mai
 static std::unordered_map<uptr, LoadstoreBackpatchInfo> s_fastmem_backpatch_info;
 static std::unordered_set<u32> s_fastmem_faulting_pcs;
 
+// Page ranges currently set in the cache map, so clearing it doesn't have to touch all of it.
+static std::vector<std::pair<u32, u32>> s_cachemap_ranges;
+
 vtlb_private::VTLBPhysical vtlb_private::VTLBPhysical::fromPointer(sptr ptr)
 {
 	pxAssertMsg(ptr >= 0, "Address too high");
@@ -120,37 +123,36 @@ __inline int ConvertPageMask(u32 PageMask)
 
 __inline int CheckCache(u32 addr)
 {
-	u32 mask;
+	return vtlbdata.cachemap[addr >> VTLB_PAGE_BITS];
+}
+
+// Rebuilds the cache map from the TLB, needs to be called whenever a TLB entry or the Config register changes.
+// Note that accesses are checked against the physical range of each cached entry, not the virtual one.
+void vtlb_UpdateCacheMap()
+{
+	for (const auto& [start, count] : s_cachemap_ranges)
+		std::memset(&vtlbdata.cachemap[start], 0, count);
+	s_cachemap_ranges.clear();
 
 	if (((cpuRegs.CP0.n.Config >> 16) & 0x1) == 0)
-	{
-		//DevCon.Warning("Data Cache Disabled! %x", cpuRegs.CP0.n.Config);
-		return false; //
-	}
+		return;
+
+	const auto mark = [](u32 pfn, u32 page_mask) {
+		const u32 start = pfn >> VTLB_PAGE_BITS;
+		const u32 count = std::min((static_cast<u32>(ConvertPageMask(page_mask)) >> VTLB_PAGE_BITS) + 1, VTLB_VMAP_ITEMS - start);
+		std::memset(&vtlbdata.cachemap[start], 1, count);
+		s_cachemap_ranges.emplace_back(start, count);
+	};
 
 	for (int i = 1; i < 48; i++)
 	{
 		if (((tlb[i].EntryLo1 & 0x38) >> 3) == 0x3)
-		{
-			mask = ConvertPageMask(tlb[i].PageMask);
-			if ((addr >= tlb[i].PFN1) && (addr <= tlb[i].PFN1 + mask))
-			{
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0);
-				return true;
-			}
-		}
+			mark(tlb[i].PFN1, tlb[i].PageMask);
 		if (((tlb[i].EntryLo0 & 0x38) >> 3) == 0x3)
-		{
-			mask = ConvertPageMask(tlb[i].PageMask);
-			if ((addr >= tlb[i].PFN0) && (addr <= tlb[i].PFN0 + mask))
-			{
-				//DevCon.Warning("Yay! Cache check cache addr=%x, mask=%x, addr+mask=%x, VPN2=%x PFN0=%x", addr, mask, (addr & mask), tlb[i].VPN2, tlb[i].PFN0);
-				return true;
-			}
-		}
+			mark(tlb[i].PFN0, tlb[i].PageMask);
 	}
-	return false;
 }
+
 // --------------------------------------------------------------------------------------
 // Interpreter Implementations of VTLB Memory Operations.
 // --------------------------------------------------------------------------------------
@@ -164,27 +166,24 @@ DataType vtlb_memRead(u32 addr)
 
 	if (!vmv.isHandler(addr))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(addr))
 		{
-			if (CHECK_CACHE && CheckCache(addr))
+			switch (DataSize)
 			{
-				switch (DataSize)
-				{
-					case 8:
-						return readCache8(addr);
-						break;
-					case 16:
-						return readCache16(addr);
-						break;
-					case 32:
-						return readCache32(addr);
-						break;
-					case 64:
-						return readCache64(addr);
-						break;
-
-						jNO_DEFAULT;
-				}
+				case 8:
+					return readCache8(addr);
+					break;
+				case 16:
+					return readCache16(addr);
+					break;
+				case 32:
+					return readCache32(addr);
+					break;
+				case 64:
+					return readCache64(addr);
+					break;
+
+					jNO_DEFAULT;
 			}
 		}
 
@@ -219,12 +218,9 @@ RETURNS_R128 vtlb_memRead128(u32 mem)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(mem))
 		{
-			if (CHECK_CACHE && CheckCache(mem))
-			{
-				return readCache128(mem);
-			}
+			return readCache128(mem);
 		}
 
 		return r128_load(reinterpret_cast<const void*>(vmv.assumePtr(mem)));
@@ -247,25 +243,22 @@ void vtlb_memWrite(u32 addr, DataType data)
 
 	if (!vmv.isHandler(addr))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(addr))
 		{
-			if (CHECK_CACHE && CheckCache(addr))
+			switch (DataSize)
 			{
-				switch (DataSize)
-				{
-					case 8:
-						writeCache8(addr, data);
-						return;
-					case 16:
-						writeCache16(addr, data);
-						return;
-					case 32:
-						writeCache32(addr, data);
-						return;
-					case 64:
-						writeCache64(addr, data);
-						return;
-				}
+				case 8:
+					writeCache8(addr, data);
+					return;
+				case 16:
+					writeCache16(addr, data);
+					return;
+				case 32:
+					writeCache32(addr, data);
+					return;
+				case 64:
+					writeCache64(addr, data);
+					return;
 			}
 		}
 
@@ -286,14 +279,11 @@ void TAKES_R128 vtlb_memWrite128(u32 mem, r128 value)
 
 	if (!vmv.isHandler(mem))
 	{
-		if (!CHECK_EEREC)
+		if (CHECK_CACHE && CheckCache(mem))
 		{
-			if (CHECK_CACHE && CheckCache(mem))
-			{
-				alignas(16) const u128 r = r128_to_u128(value);
-				writeCache128(mem, &r);
-				return;
-			}
+			alignas(16) const u128 r = r128_to_u128(value);
+			writeCache128(mem, &r);
+			return;
 		}
 
 		r128_store_unaligned((void*)vmv.assumePtr(mem), value);
@@ -569,7 +559,7 @@ static void TAKES_R128 vtlbUnmappedVWriteLg(u32 addr, r128 data) { vtlb_Miss(add
 template <typename OperandType>
 static OperandType vtlbUnmappedPReadSm(u32 addr) {
 	vtlb_BusError(addr, 0);
-	if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)){
+	if(CHECK_CACHE && CheckCache(addr)){
 		switch (sizeof(OperandType)) {
 			case 1: return readCache8(addr, false);
 			case 2: return readCache16(addr, false);
@@ -580,12 +570,12 @@ static OperandType vtlbUnmappedPReadSm(u32 addr) {
 	}
 	return 0;
 }
-static RETURNS_R128 vtlbUnmappedPReadLg(u32 addr) { vtlb_BusError(addr, 0); if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)){ return readCache128(addr, false); } return r128_zero(); }
+static RETURNS_R128 vtlbUnmappedPReadLg(u32 addr) { vtlb_BusError(addr, 0); if(CHECK_CACHE && CheckCache(addr)){ return readCache128(addr, false); } return r128_zero(); }
 
 template <typename OperandType>
 static void vtlbUnmappedPWriteSm(u32 addr, OperandType data) {
 	vtlb_BusError(addr, 1);
-	if (!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) {
+	if (CHECK_CACHE && CheckCache(addr)) {
 		switch (sizeof(OperandType)) {
 			case 1: writeCache8(addr, data, false); break;
 			case 2: writeCache16(addr, data, false); break;
@@ -595,7 +585,7 @@ static void vtlbUnmappedPWriteSm(u32 addr, OperandType data) {
 		}
 	}
 }
-static void TAKES_R128 vtlbUnmappedPWriteLg(u32 addr, r128 data) { vtlb_BusError(addr, 1); if(!CHECK_EEREC && CHECK_CACHE && CheckCache(addr)) { writeCache128(addr, reinterpret_cast<mem128_t*>(&data) /*Safe??*/, false); }}
+static void TAKES_R128 vtlbUnmappedPWriteLg(u32 addr, r128 data) { vtlb_BusError(addr, 1); if(CHECK_CACHE && CheckCache(addr)) { writeCache128(addr, reinterpret_cast<mem128_t*>(&data) /*Safe??*/, false); }}
 // clang-format on
 
 // --------------------------------------------------------------------------------------
@@ -1400,6 +1390,17 @@ void vtlb_Core_Free()
 // is 4096 (4k), which is why you'll see a lot of 0xfff's, >><< 12's, and 0x1000's in the
 // code below.
 //
+// Sub-page Tracking:
+// Each page is additionally split into 16 sub-pages of 256 bytes, and we record which of them
+// hold recompiled code.  When a protected page faults on a sub-page without any code, the page
+// is unprotected for the write but its blocks are kept, and a copy of the page is taken.  Blocks
+// compiled under write protection check the page is still protected when they're entered, and
+// if it isn't, the code sub-pages are compared against the copy: only blocks in sub-pages which
+// changed are cleared, and the page is protected again.  This is what keeps pages which mix code
+// and data from being flushed on every data write.
+//
+
+static constexpr u32 SUBPAGE_SHIFT = 8;
 
 struct vtlb_PageProtectionInfo
 {
@@ -1411,9 +1412,34 @@ struct vtlb_PageProtectionInfo
 	u32 ReverseRamMap;
 
 	vtlb_ProtectionMode Mode;
+
+	// Bitmask of sub-pages holding recompiled code.
+	u16 CodeMask;
+};
+
+// Copies of pages which were unprotected for a data write, for checking their blocks against.
+// When they're all in use, the page is cleared and put under manual protection as before.
+struct vtlb_PendingPage
+{
+	u32 RamPage = static_cast<u32>(-1);
+	alignas(16) u8 Code[__pagesize];
 };
 
+static constexpr u32 PENDING_PAGE_COUNT = 32;
+
 alignas(16) static vtlb_PageProtectionInfo m_PageProtectInfo[Ps2MemSize::TotalRam >> __pageshift];
+static vtlb_PendingPage m_PendingPages[PENDING_PAGE_COUNT];
+
+static vtlb_PendingPage* mmap_FindPendingPage(u32 rampage)
+{
+	for (vtlb_PendingPage& page : m_PendingPages)
+	{
+		if (page.RamPage == rampage)
+			return &page;
+	}
+
+	return nullptr;
+}
 
 
 // returns:
@@ -1455,6 +1481,10 @@ void mmap_MarkCountedRamPage(u32 paddr)
 	if (m_PageProtectInfo[rampage].Mode == ProtMode_Write)
 		return; // skip town if we're already protected.
 
+	// Blocks will re-protect the page once they've been checked.
+	if (m_PageProtectInfo[rampage].Mode == ProtMode_Pending)
+		return;
+
 	eeRecPerfLog.Write((m_PageProtectInfo[rampage].Mode == ProtMode_Manual) ?
 						   "Re-protecting page @ 0x%05x" :
 						   "Protected page @ 0x%05x",
@@ -1465,6 +1495,105 @@ void mmap_MarkCountedRamPage(u32 paddr)
 	vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadOnly());
 }
 
+// paddr - physically mapped PS2 address
+// Records the sub-pages covered by a block recompiled from [paddr, paddr+size). Blocks never cross pages.
+void mmap_MarkRamPageCode(u32 paddr, u32 size)
+{
+	pxAssert(eeMem && size > 0);
+
+	uptr ptr = (uptr)PSM(paddr);
+	uptr offset = ptr - (uptr)eeMem->Main;
+	if (!ptr || offset >= Ps2MemSize::ExposedRam)
+		return;
+
+	const u32 rampage = static_cast<u32>(offset >> __pageshift);
+	const u32 first = (offset & __pagemask) >> SUBPAGE_SHIFT;
+	const u32 last = ((offset & __pagemask) + size - 1) >> SUBPAGE_SHIFT;
+	const u16 mask = static_cast<u16>(((2u << last) - 1) & ~((1u << first) - 1));
+
+	// Blocks compiled while the page is waiting to be checked are checked against the code they were compiled from.
+	// Sub-pages which already had code keep their old copy, so changes to those are still seen by the older blocks.
+	vtlb_PageProtectionInfo& info = m_PageProtectInfo[rampage];
+	const u16 new_code = mask & ~info.CodeMask;
+	if (info.Mode == ProtMode_Pending && new_code != 0)
+	{
+		if (vtlb_PendingPage* page = mmap_FindPendingPage(rampage))
+		{
+			const u8* code = &eeMem->Main[rampage << __pageshift];
+			for (u32 i = first; i <= last; i++)
+			{
+				if (new_code & (1u << i))
+					std::memcpy(&page->Code[i << SUBPAGE_SHIFT], &code[i << SUBPAGE_SHIFT], 1u << SUBPAGE_SHIFT);
+			}
+		}
+	}
+
+	info.CodeMask |= mask;
+}
+
+// paddr - physically mapped PS2 address
+// Returns a pointer to the protection mode of the page, for recompiled blocks to check on entry.
+const vtlb_ProtectionMode* mmap_GetRamPageModePtr(u32 paddr)
+{
+	pxAssert(eeMem);
+
+	uptr ptr = (uptr)PSM(paddr);
+	uptr offset = ptr - (uptr)eeMem->Main;
+	if (!ptr || offset >= Ps2MemSize::ExposedRam)
+		return nullptr;
+
+	return &m_PageProtectInfo[offset >> __pageshift].Mode;
+}
+
+// paddr - physically mapped PS2 address
+// Checks the code of a page which was unprotected for a data write against the copy taken at the time. Blocks
+// in sub-pages which have changed are cleared, and the page is put back under write protection.
+// Returns false if the page wasn't waiting to be checked.
+bool mmap_VerifyRamPage(u32 paddr)
+{
+	pxAssert(eeMem);
+
+	uptr ptr = (uptr)PSM(paddr);
+	uptr offset = ptr - (uptr)eeMem->Main;
+	if (!ptr || offset >= Ps2MemSize::ExposedRam)
+		return false;
+
+	const u32 rampage = static_cast<u32>(offset >> __pageshift);
+	vtlb_PageProtectionInfo& info = m_PageProtectInfo[rampage];
+	vtlb_PendingPage* page = (info.Mode == ProtMode_Pending) ? mmap_FindPendingPage(rampage) : nullptr;
+	if (!page)
+		return false;
+
+	const u8* code = &eeMem->Main[rampage << __pageshift];
+	u16 changed = 0;
+	for (u32 i = 0; i < (__pagesize >> SUBPAGE_SHIFT); i++)
+	{
+		if ((info.CodeMask & (1u << i)) &&
+			std::memcmp(&code[i << SUBPAGE_SHIFT], &page->Code[i << SUBPAGE_SHIFT], 1u << SUBPAGE_SHIFT) != 0)
+		{
+			changed |= static_cast<u16>(1u << i);
+		}
+	}
+
+	page->RamPage = static_cast<u32>(-1);
+
+	eeRecPerfLog.Write("Re-protecting page @ 0x%05x, code changed in sub-pages 0x%04x", rampage, changed);
+
+	info.Mode = ProtMode_Write;
+	info.CodeMask &= ~changed;
+	HostSys::MemProtect(&eeMem->Main[rampage << __pageshift], __pagesize, PageAccess_ReadOnly());
+	vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadOnly());
+
+	// Size is in words.
+	for (u32 i = 0; i < (__pagesize >> SUBPAGE_SHIFT); i++)
+	{
+		if (changed & (1u << i))
+			Cpu->Clear(info.ReverseRamMap + (i << SUBPAGE_SHIFT), (1u << SUBPAGE_SHIFT) / 4);
+	}
+
+	return true;
+}
+
 // offset - offset of address relative to psM.
 // All recompiled blocks belonging to the page are cleared, and any new blocks recompiled
 // from code residing in this page will use manual protection.
@@ -1479,6 +1608,27 @@ static __fi void mmap_ClearCpuBlock(uint offset)
 	pxAssertMsg(m_PageProtectInfo[rampage].Mode != ProtMode_Manual,
 		"Attempted to clear a block that is already under manual protection.");
 
+	// We can't let the write through without unprotecting the whole page. But if it missed all the code, the
+	// blocks can stay, as long as they're checked against a copy of their code before they next run.
+	const u32 subpage = (offset & __pagemask) >> SUBPAGE_SHIFT;
+	if (!(m_PageProtectInfo[rampage].CodeMask & (1u << subpage)))
+	{
+		if (vtlb_PendingPage* page = mmap_FindPendingPage(static_cast<u32>(-1)))
+		{
+			eeRecPerfLog.Write("Data write to code page @ 0x%05x, sub-page %u", rampage, subpage);
+
+			page->RamPage = rampage;
+			std::memcpy(page->Code, &eeMem->Main[rampage << __pageshift], __pagesize);
+
+			HostSys::MemProtect(&eeMem->Main[rampage << __pageshift], __pagesize, PageAccess_ReadWrite());
+			vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadWrite());
+			m_PageProtectInfo[rampage].Mode = ProtMode_Pending;
+			return;
+		}
+	}
+
+	m_PageProtectInfo[rampage].CodeMask = 0;
+
 	HostSys::MemProtect(&eeMem->Main[rampage << __pageshift], __pagesize, PageAccess_ReadWrite());
 	vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadWrite());
 	m_PageProtectInfo[rampage].Mode = ProtMode_Manual;
@@ -1532,6 +1682,8 @@ void mmap_ResetBlockTracking()
 {
 	//DbgCon.WriteLn( "vtlb/mmap: Block Tracking reset..." );
 	std::memset(m_PageProtectInfo, 0, sizeof(m_PageProtectInfo));
+	for (vtlb_PendingPage& page : m_PendingPages)
+		page.RamPage = static_cast<u32>(-1);
 	if (eeMem)
 		HostSys::MemProtect(eeMem->Main, Ps2MemSize::ExposedRam, PageAccess_ReadWrite());
 	vtlb_UpdateFastmemProtection(0, Ps2MemSize::ExposedRam, PageAccess_ReadWrite());
@@ -46,6 +46,7 @@ extern void vtlb_Init();
 extern void vtlb_Shutdown();
 extern void vtlb_Reset();
 extern void vtlb_ResetFastmem();
+extern void vtlb_UpdateCacheMap();
 
 extern vtlbHandler vtlb_NewHandler();
 
@@ -197,6 +198,8 @@ namespace vtlb_private
 
 		uptr fastmem_base;
 
+		u8 cachemap[VTLB_VMAP_ITEMS]; //1MB // Nonzero for pages the EE data cache applies to
+
 		MapData()
 		{
 			vmap = NULL;
@@ -225,11 +228,15 @@ enum vtlb_ProtectionMode
 	ProtMode_None = 0, // page is 'unaccounted' -- neither protected nor unprotected
 	ProtMode_Write, // page is under write protection (exception handler)
 	ProtMode_Manual, // page is under manual protection (self-checked at execution)
-	ProtMode_NotRequired // page doesn't require any protection
+	ProtMode_NotRequired, // page doesn't require any protection
+	ProtMode_Pending // page was unprotected for a data write, its blocks are checked before they next run
 };
 
 extern vtlb_ProtectionMode mmap_GetRamPageInfo(u32 paddr);
 extern void mmap_MarkCountedRamPage(u32 paddr);
+extern void mmap_MarkRamPageCode(u32 paddr, u32 size);
+extern const vtlb_ProtectionMode* mmap_GetRamPageModePtr(u32 paddr);
+extern bool mmap_VerifyRamPage(u32 paddr);
 extern void mmap_ResetBlockTracking();
 
 // --------------------------------------------------------------------------------------
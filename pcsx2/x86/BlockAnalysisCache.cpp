@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "BlockAnalysisCache.h"
+
+#include "Config.h"
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include "fmt/format.h"
+
+#include <cstring>
+#include <zlib.h>
+
+namespace
+{
+	// Bump whenever the scan or the backprop passes change what they produce.
+	static constexpr u32 CACHE_VERSION = 4;
+	static constexpr u32 CACHE_MAGIC = 0x48434142; // BACH
+
+#pragma pack(push, 1)
+	struct CacheFileHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 inst_size;
+		u32 crc;
+		u32 config_key;
+		u32 num_entries;
+		u32 uncompressed_size;
+		u32 compressed_size;
+	};
+
+	struct CacheFileEntry
+	{
+		u32 start_pc;
+		u32 end_pc;
+		u32 scan_end_pc;
+		u32 branch_to;
+		u32 flags;
+		s32 aux;
+		u32 num_insts;
+		u32 num_code_words;
+	};
+#pragma pack(pop)
+} // namespace
+
+BlockAnalysisCache::BlockAnalysisCache(const char* name)
+	: m_name(name)
+{
+}
+
+BlockAnalysisCache::~BlockAnalysisCache() = default;
+
+void BlockAnalysisCache::SetGame(u32 crc, u32 config_key)
+{
+	if (m_crc == crc && m_config_key == config_key)
+		return;
+
+	Close();
+
+	m_crc = crc;
+	m_config_key = config_key;
+	if (m_crc != 0)
+		Load();
+}
+
+void BlockAnalysisCache::Close()
+{
+	Flush();
+
+	if (m_crc != 0 && (m_hits != 0 || m_misses != 0))
+	{
+		DevCon.WriteLn("(%s) Analysis cache for %08X: %u hits, %u misses, %u stale", m_name, m_crc, m_hits, m_misses, m_stale);
+	}
+
+	m_entries = {};
+	m_num_insts = 0;
+	m_use_counter = 0;
+	m_crc = 0;
+	m_config_key = 0;
+	m_hits = 0;
+	m_misses = 0;
+	m_stale = 0;
+}
+
+std::string BlockAnalysisCache::GetCachePath() const
+{
+	return Path::Combine(EmuFolders::Cache, fmt::format("{}_{:08X}.analysis", m_name, m_crc));
+}
+
+void BlockAnalysisCache::Load()
+{
+	const std::string path = GetCachePath();
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(path.c_str());
+	if (!data.has_value())
+		return;
+
+	CacheFileHeader hdr;
+	if (data->size() < sizeof(hdr))
+		return;
+
+	std::memcpy(&hdr, data->data(), sizeof(hdr));
+	if (hdr.magic != CACHE_MAGIC || hdr.version != CACHE_VERSION || hdr.inst_size != sizeof(EEINST) || hdr.crc != m_crc ||
+		hdr.config_key != m_config_key || hdr.compressed_size != (data->size() - sizeof(hdr)))
+	{
+		Console.Warning("(%s) Discarding outdated analysis cache '%s'", m_name, Path::GetFileName(path).data());
+		return;
+	}
+
+	std::vector<u8> buffer(hdr.uncompressed_size);
+	uLongf dest_len = hdr.uncompressed_size;
+	if (uncompress(buffer.data(), &dest_len, data->data() + sizeof(hdr), hdr.compressed_size) != Z_OK ||
+		dest_len != hdr.uncompressed_size)
+	{
+		Console.Error("(%s) Failed to decompress analysis cache '%s'", m_name, Path::GetFileName(path).data());
+		return;
+	}
+
+	size_t pos = 0;
+	m_entries.reserve(hdr.num_entries);
+	for (u32 i = 0; i < hdr.num_entries; i++)
+	{
+		CacheFileEntry fe;
+		if ((buffer.size() - pos) < sizeof(fe))
+			break;
+		std::memcpy(&fe, &buffer[pos], sizeof(fe));
+		pos += sizeof(fe);
+
+		const size_t insts_size = static_cast<size_t>(fe.num_insts) * sizeof(EEINST);
+		const size_t code_size = static_cast<size_t>(fe.num_code_words) * sizeof(u32);
+		if ((buffer.size() - pos) < (insts_size + code_size) || fe.end_pc < fe.start_pc || fe.scan_end_pc < fe.start_pc ||
+			fe.num_insts != ((fe.end_pc - fe.start_pc) / 4 + 1) || fe.num_code_words != ((fe.scan_end_pc - fe.start_pc) / 4))
+		{
+			break;
+		}
+
+		Entry entry;
+		entry.end_pc = fe.end_pc;
+		entry.scan_end_pc = fe.scan_end_pc;
+		entry.branch_to = fe.branch_to;
+		entry.flags = fe.flags;
+		entry.aux = fe.aux;
+		entry.last_used = 0;
+		entry.insts.resize(fe.num_insts);
+		std::memcpy(entry.insts.data(), &buffer[pos], insts_size);
+		pos += insts_size;
+		entry.code.resize(fe.num_code_words);
+		std::memcpy(entry.code.data(), &buffer[pos], code_size);
+		pos += code_size;
+
+		Insert(fe.start_pc, std::move(entry));
+	}
+
+	DevCon.WriteLn("(%s) Loaded %zu cached block analyses for %08X", m_name, m_entries.size(), m_crc);
+}
+
+void BlockAnalysisCache::Flush()
+{
+	if (!m_dirty || m_crc == 0)
+		return;
+
+	m_dirty = false;
+
+	std::vector<u8> buffer;
+	for (const auto& [start_pc, entry] : m_entries)
+	{
+		CacheFileEntry fe;
+		fe.start_pc = start_pc;
+		fe.end_pc = entry.end_pc;
+		fe.scan_end_pc = entry.scan_end_pc;
+		fe.branch_to = entry.branch_to;
+		fe.flags = entry.flags;
+		fe.aux = entry.aux;
+		fe.num_insts = static_cast<u32>(entry.insts.size());
+		fe.num_code_words = static_cast<u32>(entry.code.size());
+
+		const size_t pos = buffer.size();
+		const size_t insts_size = entry.insts.size() * sizeof(EEINST);
+		const size_t code_size = entry.code.size() * sizeof(u32);
+		buffer.resize(pos + sizeof(fe) + insts_size + code_size);
+		std::memcpy(&buffer[pos], &fe, sizeof(fe));
+		std::memcpy(&buffer[pos + sizeof(fe)], entry.insts.data(), insts_size);
+		std::memcpy(&buffer[pos + sizeof(fe) + insts_size], entry.code.data(), code_size);
+	}
+
+	uLongf compressed_size = compressBound(static_cast<uLong>(buffer.size()));
+	std::vector<u8> data(sizeof(CacheFileHeader) + compressed_size);
+	if (compress2(data.data() + sizeof(CacheFileHeader), &compressed_size, buffer.data(), static_cast<uLong>(buffer.size()),
+			Z_BEST_SPEED) != Z_OK)
+	{
+		Console.Error("(%s) Failed to compress analysis cache", m_name);
+		return;
+	}
+
+	CacheFileHeader hdr;
+	hdr.magic = CACHE_MAGIC;
+	hdr.version = CACHE_VERSION;
+	hdr.inst_size = sizeof(EEINST);
+	hdr.crc = m_crc;
+	hdr.config_key = m_config_key;
+	hdr.num_entries = static_cast<u32>(m_entries.size());
+	hdr.uncompressed_size = static_cast<u32>(buffer.size());
+	hdr.compressed_size = static_cast<u32>(compressed_size);
+	std::memcpy(data.data(), &hdr, sizeof(hdr));
+	data.resize(sizeof(hdr) + compressed_size);
+
+	const std::string path = GetCachePath();
+	if (!FileSystem::WriteBinaryFile(path.c_str(), data.data(), data.size()))
+		Console.Error("(%s) Failed to write analysis cache '%s'", m_name, Path::GetFileName(path).data());
+}
+
+void BlockAnalysisCache::Insert(u32 start_pc, Entry entry)
+{
+	m_num_insts += entry.insts.size();
+
+	const auto [it, inserted] = m_entries.try_emplace(start_pc);
+	if (!inserted)
+		m_num_insts -= it->second.insts.size();
+	it->second = std::move(entry);
+
+	if (m_num_insts > MAX_CACHED_INSTS)
+		Evict();
+}
+
+void BlockAnalysisCache::Evict()
+{
+	// Drop down to three quarters of the limit, so we're not back here on the next store.
+	std::vector<std::pair<u32, u32>> by_age;
+	by_age.reserve(m_entries.size());
+	for (const auto& [start_pc, entry] : m_entries)
+		by_age.emplace_back(entry.last_used, start_pc);
+	std::sort(by_age.begin(), by_age.end());
+
+	const size_t target = MAX_CACHED_INSTS / 4 * 3;
+	size_t evicted = 0;
+	for (const auto& [last_used, start_pc] : by_age)
+	{
+		if (m_num_insts <= target)
+			break;
+
+		const auto it = m_entries.find(start_pc);
+		m_num_insts -= it->second.insts.size();
+		m_entries.erase(it);
+		evicted++;
+	}
+
+	DevCon.WriteLn("(%s) Evicted %zu cached block analyses", m_name, evicted);
+}
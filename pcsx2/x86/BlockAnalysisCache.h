@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "iCore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Persists the per-block results of the recompiler's front end (block boundaries, branch targets, loop
+// classification and the backpropagated EEINST register/flag info) across sessions, keyed on the ELF CRC.
+// Entries keep a copy of the guest code they were produced from, and are only reused while it still matches,
+// so overlays and self-modifying code simply fall back to a fresh analysis which then replaces the stale entry.
+// The file is only written when switching games or shutting down, never on recompiler resets.
+class BlockAnalysisCache
+{
+public:
+	struct Entry
+	{
+		u32 end_pc;
+		u32 scan_end_pc;
+		u32 branch_to;
+		u32 flags;
+		s32 aux;
+
+		// Used to pick entries to evict, not saved.
+		u32 last_used;
+
+		// Analysis info for [start_pc, end_pc], including the trailing sentinel entry.
+		std::vector<EEINST> insts;
+
+		// Guest code for [start_pc, scan_end_pc), i.e. every instruction the analysis looked at.
+		std::vector<u32> code;
+	};
+
+	/// Limit on the number of instructions with cached analysis, least recently used blocks are dropped past it.
+	static constexpr size_t MAX_CACHED_INSTS = 128 * 1024;
+
+	explicit BlockAnalysisCache(const char* name);
+	~BlockAnalysisCache();
+
+	/// Switches to the cache for the specified ELF CRC, writing out the previous one if it changed.
+	/// The config key should include any settings which affect the analysis results. CRC 0 disables caching.
+	void SetGame(u32 crc, u32 config_key);
+
+	/// Writes the cache to disk if any entries were added since it was loaded, and drops all entries.
+	void Close();
+
+	bool IsEnabled() const { return m_crc != 0; }
+
+	/// Looks up the analysis for the block starting at the specified PC, validating it against the current code.
+	/// GetCodePtr returns a host pointer to the code at a PC, valid up to the end of its 4KB page, or null.
+	template <typename GetCodePtr>
+	const Entry* Lookup(u32 start_pc, const GetCodePtr& get_code_ptr);
+
+	/// Stores the analysis for a block, replacing any existing entry for the same start PC.
+	template <typename GetCodePtr>
+	void Store(u32 start_pc, Entry entry, const GetCodePtr& get_code_ptr);
+
+private:
+	static constexpr u32 CODE_PAGE_SIZE = 0x1000;
+
+	std::string GetCachePath() const;
+	void Load();
+	void Flush();
+	void Insert(u32 start_pc, Entry entry);
+	void Evict();
+
+	const char* m_name;
+	std::unordered_map<u32, Entry> m_entries;
+	size_t m_num_insts = 0;
+	u32 m_use_counter = 0;
+	u32 m_crc = 0;
+	u32 m_config_key = 0;
+	bool m_dirty = false;
+
+	u32 m_hits = 0;
+	u32 m_misses = 0;
+	u32 m_stale = 0;
+};
+
+template <typename GetCodePtr>
+const BlockAnalysisCache::Entry* BlockAnalysisCache::Lookup(u32 start_pc, const GetCodePtr& get_code_ptr)
+{
+	const auto it = m_entries.find(start_pc);
+	if (it == m_entries.end())
+	{
+		m_misses++;
+		return nullptr;
+	}
+
+	// Host pointers are only good to the end of the page, so compare a page at a time.
+	const std::vector<u32>& code = it->second.code;
+	for (size_t i = 0; i < code.size();)
+	{
+		const u32 pc = start_pc + static_cast<u32>(i * 4);
+		const size_t count = std::min<size_t>(code.size() - i, (CODE_PAGE_SIZE - (pc & (CODE_PAGE_SIZE - 1))) / 4);
+		const u32* ptr = get_code_ptr(pc);
+		if (!ptr || std::memcmp(ptr, &code[i], count * sizeof(u32)) != 0)
+		{
+			m_stale++;
+			return nullptr;
+		}
+
+		i += count;
+	}
+
+	m_hits++;
+	it->second.last_used = ++m_use_counter;
+	return &it->second;
+}
+
+template <typename GetCodePtr>
+void BlockAnalysisCache::Store(u32 start_pc, Entry entry, const GetCodePtr& get_code_ptr)
+{
+	entry.code.resize((entry.scan_end_pc - start_pc) / 4);
+	for (size_t i = 0; i < entry.code.size();)
+	{
+		const u32 pc = start_pc + static_cast<u32>(i * 4);
+		const size_t count = std::min<size_t>(entry.code.size() - i, (CODE_PAGE_SIZE - (pc & (CODE_PAGE_SIZE - 1))) / 4);
+		const u32* ptr = get_code_ptr(pc);
+		if (!ptr)
+			return;
+
+		std::memcpy(&entry.code[i], ptr, count * sizeof(u32));
+		i += count;
+	}
+
+	entry.last_used = ++m_use_counter;
+	Insert(start_pc, std::move(entry));
+	m_dirty = true;
+}
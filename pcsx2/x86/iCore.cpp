@@ -13,15 +13,16 @@ using namespace x86Emitter;
 thread_local u8* j8Ptr[32];
 thread_local u32* j32Ptr[32];
 
-u16 g_x86AllocCounter = 0;
-u16 g_xmmAllocCounter = 0;
+// The allocator state is per thread, since the IOP recompiler can run on its own thread.
+thread_local u16 g_x86AllocCounter = 0;
+thread_local u16 g_xmmAllocCounter = 0;
 
-EEINST* g_pCurInstInfo = NULL;
+thread_local EEINST* g_pCurInstInfo = NULL;
 
-_xmmregs xmmregs[iREGCNT_XMM], s_saveXMMregs[iREGCNT_XMM];
+thread_local _xmmregs xmmregs[iREGCNT_XMM], s_saveXMMregs[iREGCNT_XMM];
 
 // X86 caching
-_x86regs x86regs[iREGCNT_GPR], s_saveX86regs[iREGCNT_GPR];
+thread_local _x86regs x86regs[iREGCNT_GPR], s_saveX86regs[iREGCNT_GPR];
 
 // Clear current register mapping structure
 // Clear allocation counter
@@ -4,6 +4,7 @@
 #include "iR3000A.h"
 #include "R3000A.h"
 #include "BaseblockEx.h"
+#include "BlockAnalysisCache.h"
 #include "R5900OpcodeTables.h"
 #include "IopBios.h"
 #include "IopHw.h"
@@ -68,6 +69,8 @@ static u32 s_nInstCacheSize = 0;
 
 static BASEBLOCK* s_pCurBlock = nullptr;
 static BASEBLOCKEX* s_pCurBlockEx = nullptr;
+static Perf::PCMap s_perfPCMap;
+static BlockAnalysisCache s_analysisCache("iop");
 
 static u32 s_nEndBlock = 0; // what psxpc the current block ends
 static u32 s_branchTo;
@@ -953,6 +956,7 @@ static void recShutdown()
 {
 	safe_aligned_free(m_recBlockAlloc);
 
+	s_analysisCache.Close();
 	safe_free(s_pInstCache);
 	s_nInstCacheSize = 0;
 
@@ -966,6 +970,16 @@ static void iopClearRecLUT(BASEBLOCK* base, int count)
 		base[i].SetFnptr((uptr)iopJITCompile);
 }
 
+const BASEBLOCK* psxRecGetRAMBlocks()
+{
+	return recRAM;
+}
+
+const void* psxRecGetJITCompile()
+{
+	return iopJITCompile;
+}
+
 static __noinline s32 recExecuteBlock(s32 eeCycles)
 {
 	psxRegs.iopBreak = 0;
@@ -1448,6 +1462,7 @@ void psxRecompileNextInstruction(bool delayslot, bool swapped_delayslot)
 	const int old_code = psxRegs.code;
 	EEINST* old_inst_info = g_pCurInstInfo;
 	s_recompilingDelaySlot = delayslot;
+	s_perfPCMap.Add(xGetPtr(), psxpc);
 
 	// add breakpoint
 	if (!delayslot)
@@ -1533,6 +1548,54 @@ static void PreBlockCheck(u32 blockpc)
 }
 #endif
 
+enum : u32
+{
+	ANALYSIS_WILLBRANCH3 = (1 << 0),
+	ANALYSIS_BLOCKFF = (1 << 1),
+};
+
+static const u32* psxGetCodeForAnalysis(u32 pc)
+{
+	return iopVirtMemR<u32>(pc);
+}
+
+static bool psxCanUseAnalysisCache()
+{
+	if (!EmuConfig.Cpu.Recompiler.EnableAnalysisCache)
+		return false;
+
+	s_analysisCache.SetGame(VMManager::GetCurrentCRC(), 0);
+	return s_analysisCache.IsEnabled();
+}
+
+static const BlockAnalysisCache::Entry* psxLookupCachedAnalysis(u32 startpc)
+{
+	const BlockAnalysisCache::Entry* entry = s_analysisCache.Lookup(startpc, psxGetCodeForAnalysis);
+	if (!entry)
+		return nullptr;
+
+	// The scan stops at existing blocks, so the cached boundaries are only valid if none were compiled since.
+	for (u32 i = startpc + 4; i < entry->scan_end_pc; i += 4)
+	{
+		const uptr fnptr = PSX_GETBLOCK(i)->GetFnptr();
+		if (fnptr != (uptr)iopJITCompile && fnptr != (uptr)iopJITCompileInBlock)
+			return nullptr;
+	}
+
+	return entry;
+}
+
+static void psxReserveInstCache(u32 count)
+{
+	if (s_nInstCacheSize < count)
+	{
+		free(s_pInstCache);
+		s_nInstCacheSize = count + 9;
+		s_pInstCache = (EEINST*)malloc(sizeof(EEINST) * s_nInstCacheSize);
+		pxAssert(s_pInstCache != NULL);
+	}
+}
+
 static void iopRecRecompile(const u32 startpc)
 {
 	u32 i;
@@ -1583,6 +1646,7 @@ static void iopRecRecompile(const u32 startpc)
 	s_psxBlockCycles = 0;
 
 	// reset recomp state variables
+	s_perfPCMap.Clear();
 	psxpc = startpc;
 	g_psxHasConstReg = g_psxFlushedConstReg = 1;
 
@@ -1604,6 +1668,20 @@ static void iopRecRecompile(const u32 startpc)
 	s_nEndBlock = 0xffffffff;
 	s_branchTo = -1;
 
+	u32 scan_end = 0;
+	const bool use_analysis_cache = psxCanUseAnalysisCache();
+	if (const BlockAnalysisCache::Entry* cached = use_analysis_cache ? psxLookupCachedAnalysis(startpc) : nullptr)
+	{
+		s_nEndBlock = cached->end_pc;
+		s_branchTo = cached->branch_to;
+		willbranch3 = (cached->flags & ANALYSIS_WILLBRANCH3) ? 1 : 0;
+		s_nBlockFF = (cached->flags & ANALYSIS_BLOCKFF) != 0;
+
+		psxReserveInstCache(static_cast<u32>(cached->insts.size()));
+		std::memcpy(s_pInstCache, cached->insts.data(), sizeof(EEINST) * cached->insts.size());
+		goto AnalysisDone;
+	}
+
 	while (1)
 	{
 		BASEBLOCK* pblock = PSX_GETBLOCK(i);
@@ -1663,6 +1741,9 @@ static void iopRecRecompile(const u32 startpc)
 
 StartRecomp:
 
+	// Everything the scan read, including the branch which ended the block.
+	scan_end = willbranch3 ? s_nEndBlock : std::max(s_nEndBlock, i + 4);
+
 	s_nBlockFF = false;
 	if (s_branchTo == startpc)
 	{
@@ -1686,13 +1767,7 @@ StartRecomp:
 	{
 		EEINST* pcur;
 
-		if (s_nInstCacheSize < (s_nEndBlock - startpc) / 4 + 1)
-		{
-			free(s_pInstCache);
-			s_nInstCacheSize = (s_nEndBlock - startpc) / 4 + 10;
-			s_pInstCache = (EEINST*)malloc(sizeof(EEINST) * s_nInstCacheSize);
-			pxAssert(s_pInstCache != NULL);
-		}
+		psxReserveInstCache((s_nEndBlock - startpc) / 4 + 1);
 
 		pcur = s_pInstCache + (s_nEndBlock - startpc) / 4;
 		_recClearInst(pcur);
@@ -1707,6 +1782,19 @@ StartRecomp:
 		}
 	}
 
+	if (use_analysis_cache)
+	{
+		BlockAnalysisCache::Entry entry;
+		entry.end_pc = s_nEndBlock;
+		entry.scan_end_pc = scan_end;
+		entry.branch_to = s_branchTo;
+		entry.flags = (willbranch3 ? ANALYSIS_WILLBRANCH3 : 0) | (s_nBlockFF ? ANALYSIS_BLOCKFF : 0);
+		entry.aux = 0;
+		entry.insts.assign(s_pInstCache, s_pInstCache + (s_nEndBlock - startpc) / 4 + 1);
+		s_analysisCache.Store(startpc, std::move(entry), psxGetCodeForAnalysis);
+	}
+
+AnalysisDone:
 	g_pCurInstInfo = s_pInstCache;
 	while (!psxbranch && psxpc < s_nEndBlock)
 	{
@@ -1758,7 +1846,7 @@ StartRecomp:
 	pxAssert(xGetPtr() - recPtr < _64kb);
 	s_pCurBlockEx->x86size = xGetPtr() - recPtr;
 
-	Perf::iop.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc);
+	Perf::iop.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc, s_perfPCMap);
 
 	recPtr = xGetPtr();
 
@@ -7,6 +7,8 @@
 #include "R3000A.h"
 #include "iCore.h"
 
+struct BASEBLOCK;
+
 // Cycle penalties for particularly slow instructions.
 static const int psxInstCycles_Mult = 7;
 static const int psxInstCycles_Div = 40;
@@ -22,6 +24,11 @@ static const int psxInstCycles_Load = 0;
 
 extern uptr psxRecLUT[];
 
+// Block lookup for main RAM and the entry point of blocks which haven't been compiled yet, so the store
+// fast paths can tell whether a write has to go through the handler to invalidate recompiled code.
+extern const BASEBLOCK* psxRecGetRAMBlocks();
+extern const void* psxRecGetJITCompile();
+
 void _psxFlushConstReg(int reg);
 void _psxFlushConstRegs();
 
@@ -4,6 +4,7 @@
 #include <ctime>
 
 #include "iR3000A.h"
+#include "BaseblockEx.h"
 #include "IopMem.h"
 #include "IopDma.h"
 #include "IopGte.h"
@@ -1023,115 +1024,226 @@ PSXRECOMPILE_CONSTCODE3_PENALTY(DIVU, 1, psxInstCycles_Div);
 
 // TLB loadstore functions
 
-static u8* rpsxGetConstantAddressOperand(bool store)
+// Returns a host pointer for a constant address which can be accessed without going through the memory
+// handlers, i.e. main RAM and the parts of the hardware page which are plain memory. Stores to RAM still
+// have to check for cache isolation and recompiled code, see rpsxStore().
+static u8* rpsxGetConstantAddressOperand(u32 addr, bool* is_ram)
 {
-#if 0
-	if (!PSX_IS_CONST1(_Rs_))
-		return nullptr;
+	addr &= 0x1fffffff;
+
+	*is_ram = ((addr & 0x1f800000) == 0);
+	if (*is_ram)
+		return &iopMem->Main[addr & 0x1fffff];
+
+	const u32 page = addr & 0xf000;
+	if ((addr >> 16) == 0x1f80 && page != 0x1000 && page != 0x3000 && page != 0x8000)
+		return &iopHw[addr & 0xffff];
 
-	const u32 addr = g_psxConstRegs[_Rs_];
-	return store ? iopVirtMemW<u8>(addr) : const_cast<u8*>(iopVirtMemR<u8>(addr));
-#else
 	return nullptr;
-#endif
 }
 
-static void rpsxCalcAddressOperand()
+// Moves the address (and the value for stores) into the argument registers for the memory handlers, and
+// frees eax and the third argument register for use as scratch. Other cached registers are left alone,
+// the slow path preserves them itself.
+static void rpsxCalcMemOperands(bool store)
 {
-	// if it's a const register, just flush it, since we'll need to do that
-	// when we call the load/store function anyway
-	int rs;
-	if (PSX_IS_CONST1(_Rs_))
-		rs = _allocX86reg(X86TYPE_PSX, _Rs_, MODE_READ);
-	else
-		rs = _checkX86reg(X86TYPE_PSX, _Rs_, MODE_READ);
+	const int rs = PSX_IS_CONST1(_Rs_) ? -1 : _checkX86reg(X86TYPE_PSX, _Rs_, MODE_READ);
+	const int rt = (store && !PSX_IS_CONST1(_Rt_)) ? _checkX86reg(X86TYPE_PSX, _Rt_, MODE_READ) : -1;
 
+	// these only write back, so the values above stay in their host registers until we overwrite them
 	_freeX86reg(arg1regd);
+	if (store)
+		_freeX86reg(arg2regd);
+	_freeX86reg(eax);
+	_freeX86reg(arg3reg.GetId());
 
-	if (rs >= 0)
-		xMOV(arg1regd, xRegister32(rs));
-	else
-		xMOV(arg1regd, ptr32[&psxRegs.GPR.r[_Rs_]]);
+	const auto move_address = [rs]() {
+		if (PSX_IS_CONST1(_Rs_))
+		{
+			xMOV(arg1regd, g_psxConstRegs[_Rs_] + _Imm_);
+			return;
+		}
 
-	if (_Imm_)
-		xADD(arg1regd, _Imm_);
-}
+		if (rs >= 0)
+			xMOV(arg1regd, xRegister32(rs));
+		else
+			xMOV(arg1regd, ptr32[&psxRegs.GPR.r[_Rs_]]);
 
-static void rpsxCalcStoreOperand()
-{
-	int rt;
-	if (PSX_IS_CONST1(_Rt_))
-		rt = _allocX86reg(X86TYPE_PSX, _Rt_, MODE_READ);
-	else
-		rt = _checkX86reg(X86TYPE_PSX, _Rt_, MODE_READ);
+		if (_Imm_)
+			xADD(arg1regd, _Imm_);
+	};
 
-	_freeX86reg(arg2regd);
+	if (store && rt == arg1regd.GetId())
+	{
+		// value is sitting in the address register, get it out of the way first
+		if (rs == arg2regd.GetId())
+		{
+			xMOV(eax, arg1regd);
+			xMOV(arg1regd, arg2regd);
+			xMOV(arg2regd, eax);
+			if (_Imm_)
+				xADD(arg1regd, _Imm_);
+		}
+		else
+		{
+			xMOV(arg2regd, arg1regd);
+			move_address();
+		}
 
-	if (rt >= 0)
-		xMOV(arg2regd, xRegister32(rt));
-	else
-		xMOV(arg2regd, ptr32[&psxRegs.GPR.r[_Rt_]]);
+		return;
+	}
+
+	move_address();
+
+	if (store)
+	{
+		if (PSX_IS_CONST1(_Rt_))
+			xMOV(arg2regd, g_psxConstRegs[_Rt_]);
+		else if (rt >= 0)
+			xMOV(arg2regd, xRegister32(rt));
+		else
+			xMOV(arg2regd, ptr32[&psxRegs.GPR.r[_Rt_]]);
+	}
 }
 
-static void rpsxLoad(int size, bool sign)
+// Calls a memory handler from the slow path of an inline access. Instead of flushing the register cache
+// for the call, which would also cost the fast path, live caller-saved registers are spilled to the stack
+// around it, the same way the EE's backpatched load/store thunks do.
+static void rpsxCallMemHandler(const void* handler)
 {
-	rpsxCalcAddressOperand();
+#ifdef _WIN32
+	static constexpr u32 SHADOW_SIZE = 32;
+#else
+	static constexpr u32 SHADOW_SIZE = 0;
+#endif
 
-	if (_Rt_ != 0)
+	u32 num_gprs = 0;
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
 	{
-		PSX_DEL_CONST(_Rt_);
-		_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+		if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+			num_gprs++;
 	}
 
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xTEST(arg1regd, 0x10000000);
-	xForwardJZ8 is_ram_read;
+	// keep the stack 16 byte aligned
+	const u32 stack_size = (((num_gprs + 1) & ~1u) * 8) + SHADOW_SIZE;
+	if (stack_size > 0)
+		xSUB(rsp, stack_size);
 
-	switch (size)
+	u32 stack_offset = SHADOW_SIZE;
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
 	{
-		case 8:
-			xFastCall((void*)iopMemRead8);
-			break;
-		case 16:
-			xFastCall((void*)iopMemRead16);
-			break;
-		case 32:
-			xFastCall((void*)iopMemRead32);
-			break;
+		if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+		{
+			xMOV(ptr64[rsp + stack_offset], xRegister64(i));
+			stack_offset += 8;
+		}
+	}
 
-			jNO_DEFAULT
+	xFastCall(handler);
+
+	stack_offset = SHADOW_SIZE;
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
+	{
+		if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+		{
+			xMOV(xRegister64(i), ptr64[rsp + stack_offset]);
+			stack_offset += 8;
+		}
 	}
 
-	if (_Rt_ == 0)
+	if (stack_size > 0)
+		xADD(rsp, stack_size);
+}
+
+static void rpsxLoad(int size, bool sign)
+{
+	const void* handler = (size == 8) ? (void*)iopMemRead8 : ((size == 16) ? (void*)iopMemRead16 : (void*)iopMemRead32);
+
+	bool is_ram = false;
+	const u8* const_ptr = PSX_IS_CONST1(_Rs_) ? rpsxGetConstantAddressOperand(g_psxConstRegs[_Rs_] + _Imm_, &is_ram) : nullptr;
+	if (const_ptr)
 	{
-		// dummy read
-		is_ram_read.SetTarget();
+		// plain memory, so a dummy read has no side effects either
+		if (_Rt_ == 0)
+			return;
+
+		PSX_DEL_CONST(_Rt_);
+		_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+
+		const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
+		if (rt < 0)
+			_freeX86reg(eax);
+
+		const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
+		switch (size)
+		{
+			case 8:
+				sign ? xMOVSX(dreg, ptr8[const_ptr]) : xMOVZX(dreg, ptr8[const_ptr]);
+				break;
+			case 16:
+				sign ? xMOVSX(dreg, ptr16[const_ptr]) : xMOVZX(dreg, ptr16[const_ptr]);
+				break;
+			case 32:
+				xMOV(dreg, ptr32[const_ptr]);
+				break;
+				jNO_DEFAULT
+		}
+
+		if (rt < 0)
+			xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
 		return;
 	}
 
-	xForwardJump8 done;
-	is_ram_read.SetTarget();
+	rpsxCalcMemOperands(false);
 
-	// read from psM directly
-	xAND(arg1regd, 0x1fffff);
+	if (_Rt_ != 0)
+	{
+		PSX_DEL_CONST(_Rt_);
+		_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+	}
 
-	auto addr = xComplexAddress(rax, iopMem->Main, arg1reg);
-	switch (size)
+	if (PSX_IS_CONST1(_Rs_))
 	{
-		case 8:
-			xMOVZX(eax, ptr8[addr]);
-			break;
-		case 16:
-			xMOVZX(eax, ptr16[addr]);
-			break;
-		case 32:
-			xMOV(eax, ptr32[addr]);
-			break;
+		// constant hardware register
+		rpsxCallMemHandler(handler);
+	}
+	else
+	{
+		// anything outside of main RAM and its mirrors goes through the handler
+		xTEST(arg1regd, 0x1f800000);
+		xForwardJNZ8 slow_path;
 
-			jNO_DEFAULT
+		if (_Rt_ != 0)
+		{
+			// read from psM directly
+			xMOV(eax, arg1regd);
+			xAND(eax, 0x1fffff);
+
+			auto addr = xComplexAddress(arg3reg, iopMem->Main, rax);
+			switch (size)
+			{
+				case 8:
+					xMOVZX(eax, ptr8[addr]);
+					break;
+				case 16:
+					xMOVZX(eax, ptr16[addr]);
+					break;
+				case 32:
+					xMOV(eax, ptr32[addr]);
+					break;
+
+					jNO_DEFAULT
+			}
+		}
+
+		xForwardJump32 done;
+		slow_path.SetTarget();
+		rpsxCallMemHandler(handler);
+		done.SetTarget();
 	}
 
-	done.SetTarget();
+	if (_Rt_ == 0)
+		return;
 
 	const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
 	const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
@@ -1156,6 +1268,94 @@ static void rpsxLoad(int size, bool sign)
 		xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
 }
 
+static void rpsxStoreValue(int size, const xIndirectVoid& addr, const xRegister32& value)
+{
+	switch (size)
+	{
+		case 8:
+			xMOV(addr, xRegister8(value));
+			break;
+		case 16:
+			xMOV(addr, xRegister16(value));
+			break;
+		case 32:
+			xMOV(addr, value);
+			break;
+
+			jNO_DEFAULT
+	}
+}
+
+static void rpsxStore(int size)
+{
+	const void* handler = (size == 8) ? (void*)iopMemWrite8 : ((size == 16) ? (void*)iopMemWrite16 : (void*)iopMemWrite32);
+
+	bool is_ram = false;
+	const u32 const_addr = PSX_IS_CONST1(_Rs_) ? (g_psxConstRegs[_Rs_] + _Imm_) : 0;
+	u8* const_ptr = PSX_IS_CONST1(_Rs_) ? rpsxGetConstantAddressOperand(const_addr, &is_ram) : nullptr;
+	if (const_ptr && !is_ram)
+	{
+		// plain hardware memory, which isn't affected by cache isolation
+		const int rt = _allocX86reg(X86TYPE_PSX, _Rt_, MODE_READ);
+		rpsxStoreValue(size, ptr[const_ptr], xRegister32(rt));
+		return;
+	}
+
+	rpsxCalcMemOperands(true);
+
+	if (const_ptr)
+	{
+		// RAM writes are dropped while the cache is isolated, and ones which hit recompiled code need to
+		// go through the handler to invalidate it.
+		const BASEBLOCK* block = psxRecGetRAMBlocks() + ((const_addr & 0x1fffff) >> 2);
+		xTEST(ptr32[&psxRegs.CP0.n.Status], 0x10000);
+		xForwardJNZ8 isolated;
+		xLoadFarAddr(rax, const_cast<void*>(psxRecGetJITCompile()));
+		xCMP(ptr64[(void*)block], rax);
+		xForwardJNE8 has_code;
+
+		rpsxStoreValue(size, ptr[const_ptr], arg2regd);
+
+		xForwardJump32 done;
+		isolated.SetTarget();
+		has_code.SetTarget();
+		rpsxCallMemHandler(handler);
+		done.SetTarget();
+	}
+	else if (PSX_IS_CONST1(_Rs_))
+	{
+		// constant hardware register
+		rpsxCallMemHandler(handler);
+	}
+	else
+	{
+		xTEST(arg1regd, 0x1f800000);
+		xForwardJNZ8 not_ram;
+		xTEST(ptr32[&psxRegs.CP0.n.Status], 0x10000);
+		xForwardJNZ8 isolated;
+
+		xMOV(eax, arg1regd);
+		xAND(eax, 0x1ffffc);
+		xLoadFarAddr(arg3reg, const_cast<BASEBLOCK*>(psxRecGetRAMBlocks()));
+		xMOV(arg3reg, ptr64[rax * 2 + arg3reg]);
+		xLoadFarAddr(rax, const_cast<void*>(psxRecGetJITCompile()));
+		xCMP(arg3reg, rax);
+		xForwardJNE8 has_code;
+
+		// write to psM directly
+		xMOV(eax, arg1regd);
+		xAND(eax, 0x1fffff);
+		rpsxStoreValue(size, ptr[xComplexAddress(arg3reg, iopMem->Main, rax)], arg2regd);
+
+		xForwardJump32 done;
+		not_ram.SetTarget();
+		isolated.SetTarget();
+		has_code.SetTarget();
+		rpsxCallMemHandler(handler);
+		done.SetTarget();
+	}
+}
+
 
 REC_FUNC(LWL);
 REC_FUNC(LWR);
@@ -1189,34 +1389,17 @@ static void rpsxLW()
 
 static void rpsxSB()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite8);
+	rpsxStore(8);
 }
 
 static void rpsxSH()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite16);
+	rpsxStore(16);
 }
 
 static void rpsxSW()
 {
-	u8* ptr = rpsxGetConstantAddressOperand(true);
-	if (ptr)
-	{
-		const int rt = _allocX86reg(X86TYPE_PSX, _Rt_, MODE_READ);
-		xMOV(ptr32[ptr], xRegister32(rt));
-		return;
-	}
-
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite32);
+	rpsxStore(32);
 }
 
 //// SLL
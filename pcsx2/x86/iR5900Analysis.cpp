@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "iR5900Analysis.h"
+#include "Hw.h"
 #include "Memory.h"
 #include "DebugTools/Debug.h"
 
@@ -45,8 +46,9 @@ void __fi R5900::AnalysisPass::DumpAnnotatedBlock(u32 start, u32 end, EEINST* in
 	}
 }
 
-COP2FlagHackPass::COP2FlagHackPass()
+COP2FlagHackPass::COP2FlagHackPass(bool flag_hack)
 	: AnalysisPass()
+	, m_flag_hack(flag_hack)
 {
 }
 
@@ -68,6 +70,12 @@ void COP2FlagHackPass::Run(u32 start, u32 end, EEINST* inst_cache)
 			CommitAllFlags();
 			return true;
 		}
+		// without the hack, any store could be kicking VIF0 (e.g. SQC2 to its FIFO).
+		else if (!m_flag_hack && ((_Opcode_ >= 050 && _Opcode_ <= 056) || _Opcode_ == 037 || _Opcode_ == 071 || _Opcode_ == 076 || _Opcode_ == 077))
+		{
+			CommitAllFlags();
+			return true;
+		}
 		else if (_Opcode_ != 022)
 		{
 			// not COP2
@@ -141,7 +149,8 @@ void COP2FlagHackPass::Run(u32 start, u32 end, EEINST* inst_cache)
 			// If we're still behind the next CFC2 after the sticky bits got cleared, we need to update flags.
 			// Also do this if we're a vsqrt/vrsqrt/vdiv, these update status unconditionally.
 			const u32 sub_opcode = (cpuRegs.code & 3) | ((cpuRegs.code >> 4) & 0x7c);
-			if (apc < m_cfc2_pc || (_Rs_ >= 020 && _Funct_ >= 074 && sub_opcode >= 070 && sub_opcode <= 072))
+			// Without the hack, the sticky bits are always kept up to date.
+			if (!m_flag_hack || apc < m_cfc2_pc || (_Rs_ >= 020 && _Funct_ >= 074 && sub_opcode >= 070 && sub_opcode <= 072))
 				inst->info |= EEINST_COP2_STATUS_FLAG;
 
 			m_last_status_write = inst;
@@ -349,6 +358,247 @@ void COP2MicroFinishPass::Run(u32 start, u32 end, EEINST* inst_cache)
 #endif
 }
 
+// Returns false for addresses which can change between events, or have side effects when read.
+static bool IsPollableAddress(u32 addr, PollLoopKind* kind)
+{
+	// kseg0/kseg1 are direct mapped, and 0x20000000/0x30000000 are the uncached (accelerated) mirrors of main
+	// memory. Everything else is assumed to be the usual identity TLB mapping.
+	u32 paddr = addr;
+	if ((addr >> 30) == 2)
+		paddr = addr & 0x1fffffff;
+	else if ((addr >> 29) == 1)
+		paddr = addr & 0x0fffffff;
+
+	if (paddr >= EEMemoryMap::RCNT0_Start && paddr < EEMemoryMap::DMACext_End)
+	{
+		*kind = PollLoopKind::MMIO;
+
+		// Timer counts advance continuously, not just on events.
+		if (paddr < EEMemoryMap::RCNT3_End)
+			return ((paddr & 0x7f0) != 0);
+
+		// FIFO reads pop data.
+		if ((paddr >= EEMemoryMap::VIF0_FIFO_Start && paddr < EEMemoryMap::IPU_FIFO_End) ||
+			(paddr >= EEMemoryMap::SIO_Start && paddr < EEMemoryMap::SIO_End) ||
+			(paddr >= EEMemoryMap::SBUS_PS1_Start && paddr < EEMemoryMap::SBUS_PS1_End))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	// GS privileged registers, CSR only changes on vsync/signal/finish events.
+	if (paddr >= 0x12000000 && paddr < 0x12002000)
+	{
+		*kind = PollLoopKind::MMIO;
+		return true;
+	}
+
+	// Main memory and the scratchpad, only written by the EE itself, interrupt handlers and DMA. Anything else
+	// (VU memory, which VU1 can be writing from its own thread, the IOP's memory, or unmapped addresses) isn't.
+	if (paddr < Ps2MemSize::ExposedRam || (addr >= 0x70000000 && addr < 0x70004000))
+	{
+		*kind = PollLoopKind::RAM;
+		return true;
+	}
+
+	return false;
+}
+
+// Likely branches only execute their delay slot when taken, which for the early exits means leaving the loop.
+static bool IsLikelyBranch(u32 code)
+{
+	const u32 opcode = code >> 26;
+	const u32 rt = (code >> 16) & 0x1f;
+	return ((opcode & 074) == 024) || (opcode == 001 && (rt == 2 || rt == 3)) ||
+		   ((opcode == 020 || opcode == 021 || opcode == 022) && ((code >> 21) & 0x1f) == 010 && (rt & 2));
+}
+
+// Returns the registers written by the instructions ClassifyPollLoop() accepts, anywhere in the loop.
+static u32 GetPollLoopWrittenRegs(u32 loop_start, u32 branch_pc)
+{
+	u32 written = 0;
+	for (u32 pc = loop_start; pc < branch_pc + 8; pc += 4)
+	{
+		if (pc == branch_pc)
+			continue;
+
+		const u32 code = memRead32(pc);
+		const u32 opcode = code >> 26;
+		const u32 funct = code & 0x3f;
+		const u32 rs = (code >> 21) & 0x1f;
+
+		// imm arithmetic, loads, mfc*/cfc*
+		if ((opcode & 070) == 010 || (opcode & 076) == 030 || (opcode & 070) == 040 || (opcode & 076) == 032 ||
+			opcode == 067 || ((opcode & 074) == 020 && rs < 4))
+		{
+			written |= 1u << ((code >> 16) & 0x1f);
+		}
+		// common register arithmetic instructions
+		else if (opcode == 0 && (funct & 060) == 040 && (funct & 076) != 050)
+		{
+			written |= 1u << ((code >> 11) & 0x1f);
+		}
+		else if (IsLikelyBranch(code) && (pc + 4) != branch_pc)
+		{
+			pc += 4;
+		}
+	}
+
+	return written & ~1u;
+}
+
+PollLoopKind R5900::ClassifyPollLoop(u32 loop_start, u32 branch_pc)
+{
+	const u32 loop_end = branch_pc + 8;
+
+	// Linking branches write ra, so aren't loops which repeat themselves.
+	const u32 branch_code = memRead32(branch_pc);
+	if ((branch_code >> 26) == 3 || ((branch_code >> 26) == 1 && ((branch_code >> 16) & 0x1f) >= 16))
+		return PollLoopKind::None;
+
+	// The idea here is that as long as a loop doesn't write to a register it's already read
+	// (excepting registers initialised with constants or memory loads) or use any instructions
+	// which alter the machine state apart from registers, it will do the same thing on every
+	// iteration.
+	PollLoopKind kind = PollLoopKind::Constant;
+	u32 reads = 0, loads = 1;
+
+	// Constant registers, so we can tell what the loads are polling.
+	u32 consts = 1;
+	u32 const_values[32] = {};
+
+	// Registers which are only set before the loop, e.g. gp, or a pointer to a flag.
+	const u32 written = GetPollLoopWrittenRegs(loop_start, branch_pc);
+
+	for (u32 pc = loop_start; pc < loop_end; pc += 4)
+	{
+		if (pc == branch_pc)
+			continue;
+
+		cpuRegs.code = memRead32(pc);
+
+		// nop
+		if (cpuRegs.code == 0)
+			continue;
+		// cache, sync
+		else if (_Opcode_ == 057 || (_Opcode_ == 0 && _Funct_ == 017))
+			continue;
+		// imm arithmetic
+		else if ((_Opcode_ & 070) == 010 || (_Opcode_ & 076) == 030)
+		{
+			if (_Rt_ != 0)
+			{
+				const bool rs_const = (consts & (1u << _Rs_)) != 0;
+				consts &= ~(1u << _Rt_);
+				if (_Opcode_ == 017) // lui
+				{
+					const_values[_Rt_] = static_cast<u32>(_Imm_) << 16;
+					consts |= 1u << _Rt_;
+				}
+				else if (rs_const && (_Opcode_ == 010 || _Opcode_ == 011 || _Opcode_ == 030 || _Opcode_ == 031)) // (d)addi(u)
+				{
+					const_values[_Rt_] = const_values[_Rs_] + _Imm_;
+					consts |= 1u << _Rt_;
+				}
+				else if (rs_const && _Opcode_ == 015) // ori
+				{
+					const_values[_Rt_] = const_values[_Rs_] | _ImmU_;
+					consts |= 1u << _Rt_;
+				}
+			}
+
+			if (loads & 1 << _Rs_)
+			{
+				loads |= 1 << _Rt_;
+				continue;
+			}
+			else
+				reads |= 1 << _Rs_;
+			if (reads & 1 << _Rt_)
+				return PollLoopKind::None;
+		}
+		// common register arithmetic instructions
+		else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
+		{
+			consts &= ~(1u << _Rd_) | 1u;
+			if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
+			{
+				loads |= 1 << _Rd_;
+				continue;
+			}
+			else
+				reads |= 1 << _Rs_ | 1 << _Rt_;
+			if (reads & 1 << _Rd_)
+				return PollLoopKind::None;
+		}
+		// loads
+		else if ((_Opcode_ & 070) == 040 || (_Opcode_ & 076) == 032 || _Opcode_ == 067)
+		{
+			// Pointers set up before the loop are taken to be RAM, it's nearly always a flag or a counter. Pointers
+			// computed in the loop could be reading anything, including hardware registers, so aren't.
+			PollLoopKind load_kind = PollLoopKind::RAM;
+			if (consts & (1u << _Rs_))
+			{
+				if (!IsPollableAddress(const_values[_Rs_] + _Imm_, &load_kind))
+					return PollLoopKind::None;
+			}
+			else if (written & (1u << _Rs_))
+			{
+				return PollLoopKind::None;
+			}
+			kind = std::max(kind, load_kind);
+			consts &= ~(1u << _Rt_) | 1u;
+
+			if (loads & 1 << _Rs_)
+			{
+				loads |= 1 << _Rt_;
+				continue;
+			}
+			else
+				reads |= 1 << _Rs_;
+			if (reads & 1 << _Rt_)
+				return PollLoopKind::None;
+		}
+		// mfc*, cfc*
+		else if ((_Opcode_ & 074) == 020 && _Rs_ < 4)
+		{
+			consts &= ~(1u << _Rt_) | 1u;
+			loads |= 1 << _Rt_;
+		}
+		// bc0*, bc1*, bc2*, leaving the loop (bc0f polls for DMA completion)
+		else if ((_Opcode_ == 020 || _Opcode_ == 021 || _Opcode_ == 022) && _Rs_ == 010)
+		{
+			const u32 target = pc + 4 + (_Imm_ << 2);
+			if (target >= loop_start && target < loop_end)
+				return PollLoopKind::None;
+
+			// The delay slot of a likely exit only runs when leaving the loop.
+			if (IsLikelyBranch(cpuRegs.code) && (pc + 4) != branch_pc)
+				pc += 4;
+		}
+		// beq(l), bne(l), blez(l), bgtz(l), bltz(l), bgez(l), leaving the loop
+		else if ((_Opcode_ & 074) == 004 || (_Opcode_ & 074) == 024 || (_Opcode_ == 001 && _Rt_ < 4))
+		{
+			const u32 target = pc + 4 + (_Imm_ << 2);
+			if (target >= loop_start && target < loop_end)
+				return PollLoopKind::None;
+
+			reads |= 1 << _Rs_ | ((_Opcode_ & 076) == 004 || (_Opcode_ & 076) == 024 ? 1 << _Rt_ : 0);
+
+			if (IsLikelyBranch(cpuRegs.code) && (pc + 4) != branch_pc)
+				pc += 4;
+		}
+		else
+		{
+			return PollLoopKind::None;
+		}
+	}
+
+	return kind;
+}
+
 /////////////////////////////////////////////////////////////////////
 // Back-Prop Function Tables - Gathering Info
 // Note to anyone changing these: writes must go before reads.
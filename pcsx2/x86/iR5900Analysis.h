@@ -27,10 +27,15 @@ namespace R5900
 		void DumpAnnotatedBlock(u32 start, u32 end, EEINST* inst_cache, const F& func);
 	};
 
+	/// Works out which COP2 instructions in a block need to compute the MAC/status/clip flags, and where
+	/// the status flag needs converting between the recompiler's form and the one in VU0's registers.
+	/// With the flag hack, the sticky status bits are only kept where they're read back in the block.
+	/// Without it, every status write is kept, but MAC flags which get overwritten before they can be
+	/// read are still skipped, and the status flag only gets normalized at the end of each run.
 	class COP2FlagHackPass final : public AnalysisPass
 	{
 	public:
-		COP2FlagHackPass();
+		explicit COP2FlagHackPass(bool flag_hack);
 		~COP2FlagHackPass();
 
 		void Run(u32 start, u32 end, EEINST* inst_cache) override;
@@ -43,6 +48,7 @@ namespace R5900
 		void CommitClipFlag();
 		void CommitAllFlags();
 
+		bool m_flag_hack;
 		bool m_status_denormalized = false;
 		EEINST* m_last_status_write = nullptr;
 		EEINST* m_last_mac_write = nullptr;
@@ -59,6 +65,20 @@ namespace R5900
 
 		void Run(u32 start, u32 end, EEINST* inst_cache) override;
 	};
+
+	enum class PollLoopKind : u8
+	{
+		None,
+		Constant, // Only works on registers, e.g. an idle loop.
+		RAM, // Polls memory which is written by interrupt handlers or DMA.
+		MMIO, // Polls hardware registers.
+	};
+
+	/// Checks whether the loop starting at loop_start and ending with the backwards branch at branch_pc (and its delay
+	/// slot) can only change what it does on a scheduled event, i.e. it doesn't write anything but registers, and only
+	/// reads memory or hardware registers which aren't updated between events. Such loops can skip to the next event.
+	/// The loop can contain other conditional branches, as long as they leave the loop.
+	PollLoopKind ClassifyPollLoop(u32 loop_start, u32 branch_pc);
 } // namespace R5900
 
 void recBackpropBSC(u32 code, EEINST* prev, EEINST* pinst);
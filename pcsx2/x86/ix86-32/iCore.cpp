@@ -17,7 +17,7 @@ using namespace x86Emitter;
 extern u32 g_psxConstRegs[32];
 
 // X86 caching
-static uint g_x86checknext;
+static thread_local uint g_x86checknext;
 
 // use special x86 register allocation for ia32
 
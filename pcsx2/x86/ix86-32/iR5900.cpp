@@ -13,6 +13,7 @@
 #include "VMManager.h"
 #include "vtlb.h"
 #include "x86/BaseblockEx.h"
+#include "x86/BlockAnalysisCache.h"
 #include "x86/iR5900.h"
 #include "x86/iR5900Analysis.h"
 
@@ -37,6 +38,9 @@
 #include <zlib.h>
 #endif
 
+#include <algorithm>
+#include <deque>
+
 using namespace x86Emitter;
 using namespace R5900;
 
@@ -87,9 +91,45 @@ static u32 s_nInstCacheSize = 0;
 
 static BASEBLOCK* s_pCurBlock = nullptr;
 static BASEBLOCKEX* s_pCurBlockEx = nullptr;
+static Perf::PCMap s_perfPCMap;
+static BlockAnalysisCache s_analysisCache("ee");
 u32 s_nEndBlock = 0; // what pc the current block ends
 u32 s_branchTo;
 static bool s_nBlockFF;
+static PollLoopKind s_pollLoopKind;
+
+// How far before the block a poll loop can start, see recRecompile().
+static constexpr u32 MAX_POLL_LOOP_PREFIX = 64 * 4;
+
+#ifdef PCSX2_DEVBUILD
+// Per-loop fast-forward counts, to validate the poll loop classification.
+struct PollLoopStats
+{
+	u32 pc;
+	PollLoopKind kind;
+	u64 skips;
+	u64 skipped_cycles;
+};
+static std::deque<PollLoopStats> s_pollLoopStats;
+
+// The generated code points into s_pollLoopStats, so entries live until the recompiler is reset. Recompiles of
+// the same loop share an entry, and past the limit new loops aren't counted, so it can't grow without bound.
+static constexpr size_t MAX_POLL_LOOP_STATS = 1024;
+
+static PollLoopStats* recGetPollLoopStats(u32 pc, PollLoopKind kind)
+{
+	for (PollLoopStats& stats : s_pollLoopStats)
+	{
+		if (stats.pc == pc && stats.kind == kind)
+			return &stats;
+	}
+
+	if (s_pollLoopStats.size() >= MAX_POLL_LOOP_STATS)
+		return nullptr;
+
+	return &s_pollLoopStats.emplace_back(PollLoopStats{pc, kind, 0, 0});
+}
+#endif
 
 // save states for branches
 GPR_reg64 s_saveConstRegs[32];
@@ -346,6 +386,7 @@ void recCall(void (*func)())
 static void recRecompile(const u32 startpc);
 static void dyna_block_discard(u32 start, u32 sz);
 static void dyna_page_reset(u32 start, u32 sz);
+static void dyna_page_verify(u32 start);
 
 static const void* DispatcherEvent = nullptr;
 static const void* DispatcherReg = nullptr;
@@ -354,6 +395,7 @@ static const void* JITCompileInBlock = nullptr;
 static const void* EnterRecompiledCode = nullptr;
 static const void* DispatchBlockDiscard = nullptr;
 static const void* DispatchPageReset = nullptr;
+static const void* DispatchPageVerify = nullptr;
 
 static void recEventTest()
 {
@@ -469,6 +511,14 @@ static const void* _DynGen_DispatchPageReset()
 	return retval;
 }
 
+static const void* _DynGen_DispatchPageVerify()
+{
+	u8* retval = xGetPtr();
+	xFastCall((const void*)dyna_page_verify);
+	xJMP(DispatcherReg);
+	return retval;
+}
+
 static void _DynGen_Dispatchers()
 {
 	const u8* start = xGetAlignedCallTarget();
@@ -483,6 +533,7 @@ static void _DynGen_Dispatchers()
 	EnterRecompiledCode = _DynGen_EnterRecompiledCode();
 	DispatchBlockDiscard = _DynGen_DispatchBlockDiscard();
 	DispatchPageReset = _DynGen_DispatchPageReset();
+	DispatchPageVerify = _DynGen_DispatchPageVerify();
 
 	recBlocks.SetJITCompile(JITCompile);
 
@@ -572,6 +623,46 @@ static void recReserve()
 alignas(16) static u16 manual_page[Ps2MemSize::TotalRam >> 12];
 alignas(16) static u8 manual_counter[Ps2MemSize::TotalRam >> 12];
 
+#ifdef PCSX2_DEVBUILD
+static void recDumpPollLoopStats()
+{
+	// A loop can be classified differently when it is recompiled, so merge them by start PC.
+	std::sort(s_pollLoopStats.begin(), s_pollLoopStats.end(), [](const PollLoopStats& lhs, const PollLoopStats& rhs) {
+		return (lhs.pc < rhs.pc);
+	});
+
+	std::vector<PollLoopStats> merged;
+	for (const PollLoopStats& stats : s_pollLoopStats)
+	{
+		if (stats.skips == 0)
+			continue;
+
+		if (!merged.empty() && merged.back().pc == stats.pc)
+		{
+			merged.back().skips += stats.skips;
+			merged.back().skipped_cycles += stats.skipped_cycles;
+		}
+		else
+		{
+			merged.push_back(stats);
+		}
+	}
+	s_pollLoopStats.clear();
+
+	std::sort(merged.begin(), merged.end(), [](const PollLoopStats& lhs, const PollLoopStats& rhs) {
+		return (lhs.skipped_cycles > rhs.skipped_cycles);
+	});
+
+	static constexpr const char* kind_names[] = {"none", "constant", "RAM", "MMIO"};
+	for (size_t i = 0; i < std::min<size_t>(merged.size(), 16); i++)
+	{
+		const PollLoopStats& stats = merged[i];
+		DevCon.WriteLnFmt("(EE) Poll loop @ {:08X} ({}): {} skips, {} cycles skipped", stats.pc,
+			kind_names[static_cast<u32>(stats.kind)], stats.skips, stats.skipped_cycles);
+	}
+}
+#endif
+
 ////////////////////////////////////////////////////
 static void recResetRaw()
 {
@@ -601,6 +692,10 @@ static void recResetRaw()
 	recBlocks.Reset();
 	vtlb_ClearLoadStoreInfo();
 
+#ifdef PCSX2_DEVBUILD
+	recDumpPollLoopStats();
+#endif
+
 	g_branch = 0;
 	g_resetEeScalingStats = true;
 }
@@ -614,7 +709,11 @@ void recShutdown()
 
 	recRAM = recROM = recROM1 = recROM2 = nullptr;
 
+	s_analysisCache.Close();
 	safe_free(s_pInstCache);
+#ifdef PCSX2_DEVBUILD
+	s_pollLoopStats.clear();
+#endif
 	s_nInstCacheSize = 0;
 
 	recPtr = nullptr;
@@ -1372,6 +1471,18 @@ static void iBranchTest(u32 newpc)
 		xADD(ptr32[&cpuRegs.cycle], scaleblockcycles());
 		xCMP(eax, ptr32[&cpuRegs.cycle]);
 		xCMOVS(eax, ptr32[&cpuRegs.cycle]);
+
+#ifdef PCSX2_DEVBUILD
+		if (PollLoopStats* stats = recGetPollLoopStats(s_branchTo, s_pollLoopKind))
+		{
+			xMOV(ecx, eax);
+			xSUB(ecx, ptr32[&cpuRegs.cycle]);
+			xLoadFarAddr(rdx, stats);
+			xADD(ptr64[rdx + offsetof(PollLoopStats, skipped_cycles)], rcx);
+			xADD(ptr64[rdx + offsetof(PollLoopStats, skips)], 1);
+		}
+#endif
+
 		xMOV(ptr32[&cpuRegs.cycle], eax);
 
 		xJMP((void*)DispatcherEvent);
@@ -1655,6 +1766,8 @@ void encodeMemcheck()
 
 void recompileNextInstruction(bool delayslot, bool swapped_delay_slot)
 {
+	s_perfPCMap.Add(xGetPtr(), pc);
+
 	if (EmuConfig.EnablePatches)
 		Patch::ApplyDynamicPatches(pc);
 
@@ -2009,6 +2122,15 @@ void dyna_page_reset(u32 start, u32 sz)
 	mmap_MarkCountedRamPage(start);
 }
 
+// Called when a block under write protection finds its page was unprotected for a data write.
+// Blocks whose code has changed since are cleared, and the page is re-protected.
+void dyna_page_verify(u32 start)
+{
+	// Shouldn't happen, but don't keep coming back here if the page somehow isn't waiting to be checked.
+	if (!mmap_VerifyRamPage(start))
+		recClear(start & ~0xfffUL, 0x400);
+}
+
 static void memory_protect_recompiled_code(u32 startpc, u32 size)
 {
 	u32 inpage_ptr = HWADDR(startpc);
@@ -2021,6 +2143,9 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 	// note: blocks are guaranteed to reside within the confines of a single page.
 	const vtlb_ProtectionMode PageType = contains_thread_stack ? ProtMode_Manual : mmap_GetRamPageInfo(inpage_ptr);
 
+	if (PageType != ProtMode_NotRequired)
+		mmap_MarkRamPageCode(inpage_ptr, inpage_sz);
+
 	switch (PageType)
 	{
 		case ProtMode_NotRequired:
@@ -2030,7 +2155,19 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 		case ProtMode_Write:
 			mmap_MarkCountedRamPage(inpage_ptr);
 			manual_page[inpage_ptr >> 12] = 0;
-			break;
+			[[fallthrough]];
+
+		case ProtMode_Pending:
+		{
+			// Writes which miss all the code in a page unprotect it without clearing the blocks,
+			// so make sure the page is still protected, and have the code checked if it's not.
+			xCMP(ptr32[mmap_GetRamPageModePtr(inpage_ptr)], ProtMode_Write);
+			xForwardJE8 still_protected;
+			xMOV(arg1regd, inpage_ptr);
+			xJMP(DispatchPageVerify);
+			still_protected.SetTarget();
+		}
+		break;
 
 		case ProtMode_Manual:
 			xMOV(arg1regd, inpage_ptr);
@@ -2040,13 +2177,24 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 			u32 lpc = inpage_ptr;
 			u32 stg = inpage_sz;
 
-			while (stg > 0)
+			// Compare two instructions at a time, there's no 64-bit immediate form of CMP so it goes through rax.
+			// Neither of the discard arguments live there.
+			while (stg >= 8)
 			{
-				xCMP(ptr32[PSM(lpc)], *(u32*)PSM(lpc));
+				u64 code;
+				std::memcpy(&code, PSM(lpc), sizeof(code));
+				xMOV64(rax, code);
+				xCMP(ptr64[PSM(lpc)], rax);
 				xJNE(DispatchBlockDiscard);
 
-				stg -= 4;
-				lpc += 4;
+				stg -= 8;
+				lpc += 8;
+			}
+
+			if (stg > 0)
+			{
+				xCMP(ptr32[PSM(lpc)], *(u32*)PSM(lpc));
+				xJNE(DispatchBlockDiscard);
 			}
 
 			// Tweakpoint!  3 is a 'magic' number representing the number of times a counted block
@@ -2171,6 +2319,63 @@ static bool recSkipTimeoutLoop(s32 reg, bool is_timeout_loop)
 	return true;
 }
 
+enum : u32
+{
+	ANALYSIS_WILLBRANCH3 = (1 << 0),
+	ANALYSIS_BLOCKFF = (1 << 1),
+	ANALYSIS_TIMEOUT_LOOP = (1 << 2),
+	ANALYSIS_POLL_LOOP_KIND_SHIFT = 3,
+	ANALYSIS_POLL_LOOP_KIND_MASK = 3,
+};
+
+static const u32* recGetCodeForAnalysis(u32 pc)
+{
+	return static_cast<const u32*>(PSM(pc));
+}
+
+static bool recCanUseAnalysisCache()
+{
+	// Breakpoints split blocks, and we don't want to persist those splits.
+	if (!EmuConfig.Cpu.Recompiler.EnableAnalysisCache || CBreakPoints::GetNumBreakpoints() != 0 ||
+		CBreakPoints::GetNumMemchecks() != 0)
+	{
+		return false;
+	}
+
+	// The flag hack pass changes the COP2 flag info, so it has to be part of the key.
+	s_analysisCache.SetGame(VMManager::GetCurrentCRC(), EmuConfig.Speedhacks.vuFlagHack ? 1 : 0);
+	return s_analysisCache.IsEnabled();
+}
+
+static const BlockAnalysisCache::Entry* recLookupCachedAnalysis(u32 startpc)
+{
+	const BlockAnalysisCache::Entry* entry = s_analysisCache.Lookup(startpc, recGetCodeForAnalysis);
+	if (!entry)
+		return nullptr;
+
+	// The scan stops at existing blocks, so if one has since been compiled inside this range,
+	// the cached boundaries no longer apply.
+	for (u32 i = startpc + 4; i < entry->scan_end_pc; i += 4)
+	{
+		const uptr fnptr = PC_GETBLOCK(i)->GetFnptr();
+		if (fnptr != (uptr)JITCompile && fnptr != (uptr)JITCompileInBlock)
+			return nullptr;
+	}
+
+	return entry;
+}
+
+static void recReserveInstCache(u32 count)
+{
+	if (s_nInstCacheSize < count)
+	{
+		free(s_pInstCache);
+		s_nInstCacheSize = count + 9;
+		s_pInstCache = (EEINST*)malloc(sizeof(EEINST) * s_nInstCacheSize);
+		pxAssert(s_pInstCache != NULL);
+	}
+}
+
 static void recRecompile(const u32 startpc)
 {
 	u32 i = 0;
@@ -2241,6 +2446,7 @@ static void recRecompile(const u32 startpc)
 	// reset recomp state variables
 	s_nBlockCycles = 0;
 	s_nBlockInterlocked = false;
+	s_perfPCMap.Clear();
 	pc = startpc;
 	g_cpuHasConstReg = g_cpuFlushedConstReg = 1;
 	pxAssert(g_cpuConstRegs[0].UD[0] == 0);
@@ -2292,6 +2498,9 @@ static void recRecompile(const u32 startpc)
 	//
 	s32 timeout_reg = -1;
 	bool is_timeout_loop = true;
+	bool has_cop2_instructions = false;
+	u32 scan_end = 0;
+	const bool use_analysis_cache = recCanUseAnalysisCache();
 
 	// compile breakpoints as individual blocks
 	const int n1 = isBreakpointNeeded(i);
@@ -2303,6 +2512,21 @@ static void recRecompile(const u32 startpc)
 		goto StartRecomp;
 	}
 
+	if (const BlockAnalysisCache::Entry* cached = use_analysis_cache ? recLookupCachedAnalysis(startpc) : nullptr)
+	{
+		s_nEndBlock = cached->end_pc;
+		s_branchTo = cached->branch_to;
+		willbranch3 = (cached->flags & ANALYSIS_WILLBRANCH3) ? 1 : 0;
+		s_nBlockFF = (cached->flags & ANALYSIS_BLOCKFF) != 0;
+		s_pollLoopKind = static_cast<PollLoopKind>((cached->flags >> ANALYSIS_POLL_LOOP_KIND_SHIFT) & ANALYSIS_POLL_LOOP_KIND_MASK);
+		is_timeout_loop = (cached->flags & ANALYSIS_TIMEOUT_LOOP) != 0;
+		timeout_reg = cached->aux;
+
+		recReserveInstCache(static_cast<u32>(cached->insts.size()));
+		std::memcpy(s_pInstCache, cached->insts.data(), sizeof(EEINST) * cached->insts.size());
+		goto AnalysisDone;
+	}
+
 	while (1)
 	{
 		BASEBLOCK* pblock = PC_GETBLOCK(i);
@@ -2445,103 +2669,29 @@ static void recRecompile(const u32 startpc)
 
 StartRecomp:
 
-	// The idea here is that as long as a loop doesn't write to a register it's already read
-	// (excepting registers initialised with constants or memory loads) or use any instructions
-	// which alter the machine state apart from registers, it will do the same thing on every
-	// iteration.
+	// Everything the scan read, including the branch which ended the block.
+	scan_end = willbranch3 ? s_nEndBlock : std::max(s_nEndBlock, i + 4);
+
+	// Loops which only poll memory or hardware registers can skip ahead to the next event. They're allowed to start
+	// before this block when they have early exits, in which case the protection covers the whole loop, which has
+	// to stay within the page like the block itself.
 	s_nBlockFF = false;
-	if (s_branchTo == startpc)
+	s_pollLoopKind = PollLoopKind::None;
+	if (s_branchTo <= startpc && (startpc - s_branchTo) < MAX_POLL_LOOP_PREFIX &&
+		(s_branchTo & ~0xfffu) == (startpc & ~0xfffu) && !willbranch3 && s_nEndBlock >= (startpc + 8))
 	{
-		s_nBlockFF = true;
-
-		u32 reads = 0, loads = 1;
-
-		for (i = startpc; i < s_nEndBlock; i += 4)
-		{
-			if (i == s_nEndBlock - 8)
-				continue;
-			cpuRegs.code = *(u32*)PSM(i);
-			// nop
-			if (cpuRegs.code == 0)
-				continue;
-			// cache, sync
-			else if (_Opcode_ == 057 || (_Opcode_ == 0 && _Funct_ == 017))
-				continue;
-			// imm arithmetic
-			else if ((_Opcode_ & 070) == 010 || (_Opcode_ & 076) == 030)
-			{
-				if (loads & 1 << _Rs_)
-				{
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// common register arithmetic instructions
-			else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
-			{
-				if (loads & 1 << _Rs_ && loads & 1 << _Rt_)
-				{
-					loads |= 1 << _Rd_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_ | 1 << _Rt_;
-				if (reads & 1 << _Rd_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// loads
-			else if ((_Opcode_ & 070) == 040 || (_Opcode_ & 076) == 032 || _Opcode_ == 067)
-			{
-				if (loads & 1 << _Rs_)
-				{
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_)
-				{
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// mfc*, cfc*
-			else if ((_Opcode_ & 074) == 020 && _Rs_ < 4)
-			{
-				loads |= 1 << _Rt_;
-			}
-			else
-			{
-				s_nBlockFF = false;
-				break;
-			}
-		}
+		s_pollLoopKind = ClassifyPollLoop(s_branchTo, s_nEndBlock - 8);
+		s_nBlockFF = (s_pollLoopKind != PollLoopKind::None);
 	}
-	else
+
+	if (s_branchTo != startpc)
 	{
 		is_timeout_loop = false;
 	}
 
 	// rec info //
-	bool has_cop2_instructions = false;
 	{
-		if (s_nInstCacheSize < (s_nEndBlock - startpc) / 4 + 1)
-		{
-			free(s_pInstCache);
-			s_nInstCacheSize = (s_nEndBlock - startpc) / 4 + 10;
-			s_pInstCache = (EEINST*)malloc(sizeof(EEINST) * s_nInstCacheSize);
-			pxAssert(s_pInstCache != NULL);
-		}
+		recReserveInstCache((s_nEndBlock - startpc) / 4 + 1);
 
 		EEINST* pcur = s_pInstCache + (s_nEndBlock - startpc) / 4;
 		_recClearInst(pcur);
@@ -2563,10 +2713,26 @@ StartRecomp:
 	{
 		COP2MicroFinishPass().Run(startpc, s_nEndBlock, s_pInstCache + 1);
 
-		if (EmuConfig.Speedhacks.vuFlagHack)
-			COP2FlagHackPass().Run(startpc, s_nEndBlock, s_pInstCache + 1);
+		COP2FlagHackPass(EmuConfig.Speedhacks.vuFlagHack).Run(startpc, s_nEndBlock, s_pInstCache + 1);
 	}
 
+	// The cache only validates the code in the block, not the start of a loop before it.
+	if (use_analysis_cache && (!s_nBlockFF || s_branchTo == startpc))
+	{
+		BlockAnalysisCache::Entry entry;
+		entry.end_pc = s_nEndBlock;
+		entry.scan_end_pc = scan_end;
+		entry.branch_to = s_branchTo;
+		entry.flags = (willbranch3 ? ANALYSIS_WILLBRANCH3 : 0) | (s_nBlockFF ? ANALYSIS_BLOCKFF : 0) |
+		              (is_timeout_loop ? ANALYSIS_TIMEOUT_LOOP : 0) |
+		              (static_cast<u32>(s_pollLoopKind) << ANALYSIS_POLL_LOOP_KIND_SHIFT);
+		entry.aux = timeout_reg;
+		entry.insts.assign(s_pInstCache, s_pInstCache + (s_nEndBlock - startpc) / 4 + 1);
+		s_analysisCache.Store(startpc, std::move(entry), recGetCodeForAnalysis);
+	}
+
+AnalysisDone:
+
 #ifdef DUMP_BLOCKS
 	ZydisDecoder disas_decoder;
 	ZydisDecoderInit(&disas_decoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_ADDRESS_WIDTH_64);
@@ -2587,8 +2753,9 @@ StartRecomp:
 #endif
 #endif
 
-	// Detect and handle self-modified code
-	memory_protect_recompiled_code(startpc, (s_nEndBlock - startpc) >> 2);
+	// Detect and handle self-modified code, including the start of a poll loop before the block.
+	const u32 protect_start = (s_nBlockFF && s_branchTo < startpc) ? s_branchTo : startpc;
+	memory_protect_recompiled_code(protect_start, (s_nEndBlock - protect_start) >> 2);
 
 	// Skip Recompilation if sceMpegIsEnd Pattern detected
 	const bool doRecompilation = !skipMPEG_By_Pattern(startpc) && !recSkipTimeoutLoop(timeout_reg, is_timeout_loop);
@@ -2722,7 +2889,7 @@ StartRecomp:
 		iDumpBlock(s_pCurBlockEx->startpc, s_pCurBlockEx->size*4, s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size);
 	}
 #endif
-	Perf::ee.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc);
+	Perf::ee.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc, s_perfPCMap);
 
 	recPtr = xGetPtr();
 
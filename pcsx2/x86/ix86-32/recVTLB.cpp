@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Common.h"
+#include "Cache.h"
 #include "vtlb.h"
 #include "x86/iCore.h"
 #include "x86/iR5900.h"
@@ -116,8 +117,48 @@ static void __vectorcall LogWriteQuad(u32 addr, __m128i val)
 }
 #endif
 
+// Called by the cached access paths when the line isn't present.
+static u8 vtlb_ReadCache8(u32 addr) { return readCache8(addr); }
+static u16 vtlb_ReadCache16(u32 addr) { return readCache16(addr); }
+static u32 vtlb_ReadCache32(u32 addr) { return readCache32(addr); }
+static u64 vtlb_ReadCache64(u32 addr) { return readCache64(addr); }
+static RETURNS_R128 vtlb_ReadCache128(u32 addr) { return readCache128(addr); }
+static void vtlb_WriteCache8(u32 addr, u8 data) { writeCache8(addr, data); }
+static void vtlb_WriteCache16(u32 addr, u16 data) { writeCache16(addr, data); }
+static void vtlb_WriteCache32(u32 addr, u32 data) { writeCache32(addr, data); }
+static void vtlb_WriteCache64(u32 addr, u64 data) { writeCache64(addr, data); }
+static void TAKES_R128 vtlb_WriteCache128(u32 addr, r128 data)
+{
+	alignas(16) const u128 r = r128_to_u128(data);
+	writeCache128(addr, &r);
+}
+
 namespace vtlb_private
 {
+	// ------------------------------------------------------------------------
+	// Moves the value to be stored into the argument register for the handlers.
+	static void DynGen_PrepValue(int value_reg, u32 sz, bool xmm)
+	{
+		if (sz == 128)
+		{
+			pxAssert(xmm);
+			_freeXMMreg(xRegisterSSE::GetArgRegister(1, 0).GetId());
+			xMOVAPS(xRegisterSSE::GetArgRegister(1, 0), xRegisterSSE::GetInstance(value_reg));
+		}
+		else if (xmm)
+		{
+			// 32bit xmms are passed in GPRs
+			pxAssert(sz == 32);
+			_freeX86reg(arg2regd);
+			xMOVD(arg2regd, xRegisterSSE(value_reg));
+		}
+		else
+		{
+			_freeX86reg(arg2regd);
+			xMOV(arg2reg, xRegister64(value_reg));
+		}
+	}
+
 	// ------------------------------------------------------------------------
 	// Prepares eax, ecx, and, ebx for Direct or Indirect operations.
 	// Returns the writeback pointer for ebx (return address from indirect handling)
@@ -130,26 +171,7 @@ namespace vtlb_private
 		xMOV(arg1regd, xRegister32(addr_reg));
 
 		if (value_reg >= 0)
-		{
-			if (sz == 128)
-			{
-				pxAssert(xmm);
-				_freeXMMreg(xRegisterSSE::GetArgRegister(1, 0).GetId());
-				xMOVAPS(xRegisterSSE::GetArgRegister(1, 0), xRegisterSSE::GetInstance(value_reg));
-			}
-			else if (xmm)
-			{
-				// 32bit xmms are passed in GPRs
-				pxAssert(sz == 32);
-				_freeX86reg(arg2regd);
-				xMOVD(arg2regd, xRegisterSSE(value_reg));
-			}
-			else
-			{
-				_freeX86reg(arg2regd);
-				xMOV(arg2reg, xRegister64(value_reg));
-			}
-		}
+			DynGen_PrepValue(value_reg, sz, xmm);
 
 		xMOV(eax, arg1regd);
 		xSHR(eax, VTLB_PAGE_BITS);
@@ -223,6 +245,95 @@ namespace vtlb_private
 				break;
 		}
 	}
+
+	// ------------------------------------------------------------------------
+	// Emits a lookup in the EE data cache, accessing the line directly when it's present.
+	// In: arg1reg: host pointer, r11d: guest address, arg2reg/xmm arg 1: value (writes)
+	// Out: rax/xmm0: result (reads)
+	//
+	// Tags hold the host address of the line's page, so they're compared against the page of the host pointer.
+	// Misses go to Cache.cpp, as do hits on locked lines, since it picks the other way for those.
+	static void DynGen_CacheLookup(int mode, u32 bits, bool sign)
+	{
+		static_assert(CACHE_SET_SIZE == 3 * CACHE_LINE_SIZE && CACHE_LINE_SIZE == 64);
+		const s32 tag_mask = static_cast<s32>(~VTLB_PAGE_MASK | CACHE_TAG_VALID | CACHE_TAG_LOCK);
+		const u32 bytes = bits / 8;
+
+		xMOV(rax, arg1reg);
+		xAND(rax, -static_cast<s32>(VTLB_PAGE_SIZE));
+		xOR(rax, CACHE_TAG_VALID);
+
+		// set = cache + ((addr >> 6) & 63) * 192
+		xMOV(r10d, arg1regd);
+		xSHR(r10d, 6);
+		xAND(r10d, CACHE_NUM_SETS - 1);
+		xLEA(r10, ptr[r10 * 2 + r10]);
+		xSHL(r10d, 6);
+		xLoadFarAddr(arg3reg, getCacheSets());
+		xADD(arg3reg, r10);
+
+		xMOV(r10, ptr64[arg3reg + CACHE_TAG_OFFSET]);
+		xAND(r10, tag_mask);
+		xCMP(r10, rax);
+		xForwardJNE8 not_way0;
+		if (mode)
+			xOR(ptr8[arg3reg + CACHE_TAG_OFFSET], CACHE_TAG_DIRTY);
+		xForwardJump8 hit;
+
+		not_way0.SetTarget();
+		xMOV(r10, ptr64[arg3reg + (CACHE_TAG_OFFSET + CACHE_TAG_SIZE)]);
+		xAND(r10, tag_mask);
+		xCMP(r10, rax);
+		xForwardJNE32 miss;
+		if (mode)
+			xOR(ptr8[arg3reg + (CACHE_TAG_OFFSET + CACHE_TAG_SIZE)], CACHE_TAG_DIRTY);
+		xADD(arg3reg, CACHE_LINE_SIZE);
+
+		hit.SetTarget();
+		xAND(arg1regd, CACHE_LINE_SIZE - bytes);
+		xLEA(arg1reg, ptr[arg3reg + arg1reg + CACHE_DATA_OFFSET]);
+		if (mode)
+			DynGen_DirectWrite(bits);
+		else
+			DynGen_DirectRead(bits, sign);
+		xADD(ptr64[&g_cacheStats.inline_hits], 1);
+		xForwardJump32 done;
+
+		miss.SetTarget();
+		xMOV(arg1regd, r11d);
+		switch (bits)
+		{
+			case 8:
+				xFastCall(mode ? (void*)vtlb_WriteCache8 : (void*)vtlb_ReadCache8);
+				if (!mode)
+					sign ? xMOVSX(rax, al) : xMOVZX(eax, al);
+				break;
+
+			case 16:
+				xFastCall(mode ? (void*)vtlb_WriteCache16 : (void*)vtlb_ReadCache16);
+				if (!mode)
+					sign ? xMOVSX(rax, ax) : xMOVZX(eax, ax);
+				break;
+
+			case 32:
+				xFastCall(mode ? (void*)vtlb_WriteCache32 : (void*)vtlb_ReadCache32);
+				if (!mode)
+					sign ? xMOVSX(rax, eax) : xMOV(eax, eax);
+				break;
+
+			case 64:
+				xFastCall(mode ? (void*)vtlb_WriteCache64 : (void*)vtlb_ReadCache64);
+				break;
+
+			case 128:
+				xFastCall(mode ? (void*)vtlb_WriteCache128 : (void*)vtlb_ReadCache128);
+				break;
+
+				jNO_DEFAULT
+		}
+
+		done.SetTarget();
+	}
 } // namespace vtlb_private
 
 static constexpr u32 INDIRECT_DISPATCHER_SIZE = 32;
@@ -259,6 +370,29 @@ static void DynGen_HandlerTest(const GenDirectFn& gen_direct, int mode, int bits
 		case 128: szidx = 4; break;
 		jNO_DEFAULT;
 	}
+
+	if (CHECK_CACHE)
+	{
+		// Pages covered by the data cache have to go through it, everything else is accessed directly.
+		xForwardJS32 to_handler;
+		xMOV(r11d, arg1regd);
+		xSUB(r11d, eax);
+		xMOV(r10d, r11d);
+		xSHR(r10d, VTLB_PAGE_BITS);
+		xCMP(ptr8[xComplexAddress(arg3reg, vtlbdata.cachemap, r10 * 1)], 0);
+		xForwardJE32 uncached;
+		DynGen_CacheLookup(mode, bits, sign);
+		xForwardJump32 cached_done;
+		uncached.SetTarget();
+		gen_direct();
+		xForwardJump8 done;
+		to_handler.SetTarget();
+		xFastCall(GetIndirectDispatcherPtr(mode, szidx, sign));
+		cached_done.SetTarget();
+		done.SetTarget();
+		return;
+	}
+
 	xForwardJS8 to_handler;
 	gen_direct();
 	xForwardJump8 done;
@@ -267,6 +401,26 @@ static void DynGen_HandlerTest(const GenDirectFn& gen_direct, int mode, int bits
 	done.SetTarget();
 }
 
+// ------------------------------------------------------------------------
+// Generates a cache-aware access to a constant, non-handler address.
+// Whether the page is cached is still checked at runtime, because the cache map can change through the
+// Config register, which doesn't clear the recompiler.
+// In: arg2reg/xmm arg 1: value (writes)
+// Out: rax/xmm0: result (reads)
+template <typename GenDirectFn>
+static void DynGen_ConstCacheTest(const GenDirectFn& gen_direct, int mode, int bits, bool sign, u32 addr_const)
+{
+	xLoadFarAddr(arg1reg, reinterpret_cast<void*>(vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS].assumePtr(addr_const)));
+	xCMP(ptr8[&vtlbdata.cachemap[addr_const >> VTLB_PAGE_BITS]], 0);
+	xForwardJE32 uncached;
+	xMOV(r11d, addr_const);
+	DynGen_CacheLookup(mode, bits, sign);
+	xForwardJump8 done;
+	uncached.SetTarget();
+	gen_direct();
+	done.SetTarget();
+}
+
 // ------------------------------------------------------------------------
 // Generates the various instances of the indirect dispatchers
 // In: arg1reg: vtlb entry, arg2reg: data ptr (if mode >= 64), rbx: function return ptr
@@ -369,7 +523,7 @@ int vtlb_DynGenReadNonQuad(u32 bits, bool sign, bool xmm, int addr_reg, vtlb_Rea
 	pxAssume(bits <= 64);
 
 	int x86_dest_reg;
-	if (!CHECK_FASTMEM || vtlb_IsFaultingPC(pc))
+	if (!CHECK_FASTMEM || CHECK_CACHE || vtlb_IsFaultingPC(pc))
 	{
 		iFlushCall(FLUSH_FULLVTLB);
 
@@ -453,7 +607,24 @@ int vtlb_DynGenReadNonQuad_Const(u32 bits, bool sign, bool xmm, u32 addr_const,
 
 	int x86_dest_reg;
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (!vmv.isHandler(addr_const) && CHECK_CACHE)
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		DynGen_ConstCacheTest([bits, sign]() { DynGen_DirectRead(bits, sign); }, 0, bits, sign, addr_const);
+
+		if (!xmm)
+		{
+			x86_dest_reg = dest_reg_alloc ? dest_reg_alloc() : (_freeX86reg(eax), eax.GetId());
+			xMOV(xRegister64(x86_dest_reg), rax);
+		}
+		else
+		{
+			pxAssert(bits == 32);
+			x86_dest_reg = dest_reg_alloc ? dest_reg_alloc() : (_freeXMMreg(0), 0);
+			xMOVDZX(xRegisterSSE(x86_dest_reg), eax);
+		}
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		auto ppf = vmv.assumePtr(addr_const);
 		if (!xmm)
@@ -557,7 +728,7 @@ int vtlb_DynGenReadQuad(u32 bits, int addr_reg, vtlb_ReadRegAllocCallback dest_r
 {
 	pxAssume(bits == 128);
 
-	if (!CHECK_FASTMEM || vtlb_IsFaultingPC(pc))
+	if (!CHECK_FASTMEM || CHECK_CACHE || vtlb_IsFaultingPC(pc))
 	{
 		iFlushCall(FLUSH_FULLVTLB);
 
@@ -600,7 +771,16 @@ int vtlb_DynGenReadQuad_Const(u32 bits, u32 addr_const, vtlb_ReadRegAllocCallbac
 
 	int reg;
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (!vmv.isHandler(addr_const) && CHECK_CACHE)
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		DynGen_ConstCacheTest([bits]() { DynGen_DirectRead(bits, false); }, 0, bits, false, addr_const);
+
+		reg = dest_reg_alloc ? dest_reg_alloc() : (_freeXMMreg(0), 0);
+		if (reg >= 0)
+			xMOVAPS(xRegisterSSE(reg), xmm0);
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		void* ppf = reinterpret_cast<void*>(vmv.assumePtr(addr_const));
 		reg = dest_reg_alloc ? dest_reg_alloc() : (_freeXMMreg(0), 0);
@@ -682,7 +862,7 @@ void vtlb_DynGenWrite(u32 sz, bool xmm, int addr_reg, int value_reg)
 	}
 #endif
 
-	if (!CHECK_FASTMEM || vtlb_IsFaultingPC(pc))
+	if (!CHECK_FASTMEM || CHECK_CACHE || vtlb_IsFaultingPC(pc))
 	{
 		iFlushCall(FLUSH_FULLVTLB);
 
@@ -804,7 +984,14 @@ void vtlb_DynGenWrite_Const(u32 bits, bool xmm, u32 addr_const, int value_reg)
 #endif
 
 	auto vmv = vtlbdata.vmap[addr_const >> VTLB_PAGE_BITS];
-	if (!vmv.isHandler(addr_const))
+	if (!vmv.isHandler(addr_const) && CHECK_CACHE)
+	{
+		iFlushCall(FLUSH_FULLVTLB);
+		_freeX86reg(arg1regd);
+		DynGen_PrepValue(value_reg, bits, xmm);
+		DynGen_ConstCacheTest([bits]() { DynGen_DirectWrite(bits); }, 1, bits, false, addr_const);
+	}
+	else if (!vmv.isHandler(addr_const))
 	{
 		auto ppf = vmv.assumePtr(addr_const);
 		if (!xmm)
@@ -694,6 +694,7 @@ static void mvuPreloadRegisters(microVU& mVU, u32 endCount)
 void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 {
 	microFlagCycles mFC;
+	Perf::PCMap perfPCMap;
 	u8* thisPtr = x86Ptr;
 	const u32 endCount = (((microRegInfo*)pState)->blockType) ? 1 : (mVU.microMemSize / 8);
 
@@ -858,6 +859,8 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 
 	for (; x < endCount; x++)
 	{
+		perfPCMap.Add(x86Ptr, xPC);
+
 #if 0
 		if (mVU.index == 1 && (x == 0 || true))
 		{
@@ -992,9 +995,9 @@ perf_and_return:
 	if (mVU.regs().start_pc == startPC)
 	{
 		if (mVU.index)
-			Perf::vu1.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC);
+			Perf::vu1.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC, perfPCMap);
 		else
-			Perf::vu0.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC);
+			Perf::vu0.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC, perfPCMap);
 	}
 
 	return thisPtr;
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/IPU/IPU_MultiISA.h"
+#include "pcsx2/IPU/yuv2rgb.h"
+
+#include "common/Timer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include "cpuinfo.h"
+
+// Checks the IPU's vectorized IDCT, colour space conversion, dithering and VQ kernels against the
+// scalar reference implementations, for whichever ISA this file is being compiled for.
+
+#ifdef MULTI_ISA_UNSHARED_COMPILATION
+
+enum class TestISA
+{
+	isa_sse4,
+	isa_avx,
+	isa_avx2,
+	isa_native,
+};
+
+static bool CheckCapabilities(TestISA required_caps)
+{
+	cpuinfo_initialize();
+	if (required_caps == TestISA::isa_avx && !cpuinfo_has_x86_avx())
+		return false;
+	if (required_caps == TestISA::isa_avx2 && !cpuinfo_has_x86_avx2())
+		return false;
+
+	return true;
+}
+
+#define MULTI_ISA_STRINGIZE_(x) #x
+#define MULTI_ISA_STRINGIZE(x) MULTI_ISA_STRINGIZE_(x)
+
+#define MULTI_ISA_CONCAT_(a, b) a##b
+#define MULTI_ISA_CONCAT(a, b) MULTI_ISA_CONCAT_(a, b)
+
+#define MULTI_ISA_TEST(group, name) TEST(MULTI_ISA_CONCAT(MULTI_ISA_CONCAT(MULTI_ISA_UNSHARED_COMPILATION, _), group), name)
+#define SKIP_IF_UNSUPPORTED() \
+	if (!CheckCapabilities(TestISA::MULTI_ISA_UNSHARED_COMPILATION)) { \
+		GTEST_SKIP() << "Host CPU does not support " MULTI_ISA_STRINGIZE(MULTI_ISA_UNSHARED_COMPILATION); \
+	}
+
+#else
+
+#define MULTI_ISA_TEST(group, name) TEST(group, name)
+#define SKIP_IF_UNSUPPORTED()
+
+#endif
+
+MULTI_ISA_UNSHARED_START
+
+static void RandomizeBlock(s16* block, std::mt19937& rng, u32 iter)
+{
+	for (int i = 0; i < 64; i++)
+	{
+		switch (iter % 4)
+		{
+			// What a legal stream can produce.
+			case 0: block[i] = static_cast<s16>(static_cast<int>(rng() % 4096) - 2048); break;
+			// Mostly zero, like most blocks are.
+			case 1: block[i] = (rng() % 8 == 0) ? static_cast<s16>(static_cast<int>(rng() % 512) - 256) : 0; break;
+			// DC only.
+			case 2: block[i] = (i == 0) ? static_cast<s16>(static_cast<int>(rng() % 4096) - 2048) : 0; break;
+			// Anything, corrupted streams included.
+			default: block[i] = static_cast<s16>(rng()); break;
+		}
+	}
+}
+
+static void RandomizeMacroblock(std::mt19937& rng)
+{
+	u8* mb8 = reinterpret_cast<u8*>(&decoder.mb8);
+	for (size_t i = 0; i < sizeof(decoder.mb8); i++)
+		mb8[i] = static_cast<u8>(rng());
+}
+
+static void RandomizeRGB32(macroblock_rgb32& rgb32, std::mt19937& rng)
+{
+	for (auto& row : rgb32.c)
+	{
+		for (auto& pixel : row)
+		{
+			// Both alpha values ipu_csc() produces, so the alpha bit gets tested.
+			u32 value = rng();
+			value = (value & 0x00ffffff) | ((rng() & 1) ? 0x40000000 : 0x80000000);
+			std::memcpy(&pixel, &value, sizeof(value));
+		}
+	}
+}
+
+static void RandomizeRGB16(macroblock_rgb16& rgb16, std::mt19937& rng)
+{
+	for (auto& row : rgb16.c)
+	{
+		for (auto& pixel : row)
+		{
+			const u16 value = static_cast<u16>(rng());
+			std::memcpy(&pixel, &value, sizeof(value));
+		}
+	}
+}
+
+static void RandomizeCLUT(std::mt19937& rng, u32 iter)
+{
+	for (rgb16_t& entry : g_ipu_vqclut)
+	{
+		const u16 value = static_cast<u16>(rng());
+		std::memcpy(&entry, &value, sizeof(value));
+	}
+
+	// Duplicate entries, so ties get tested.
+	if (iter & 1)
+		g_ipu_vqclut[rng() % 16] = g_ipu_vqclut[rng() % 16];
+}
+
+MULTI_ISA_TEST(IPUKernels, IDCTMatchesReference)
+{
+	SKIP_IF_UNSUPPORTED();
+	std::mt19937 rng(1234);
+
+	for (u32 iter = 0; iter < 16384; iter++)
+	{
+		alignas(32) s16 expected[64];
+		alignas(32) s16 actual[64];
+		RandomizeBlock(expected, rng, iter);
+		std::memcpy(actual, expected, sizeof(actual));
+
+		ipu_idct_reference(expected);
+		ipu_idct(actual);
+		for (int i = 0; i < 64; i++)
+			ASSERT_EQ(actual[i], expected[i]) << "iteration " << iter << " coefficient " << i;
+	}
+}
+
+MULTI_ISA_TEST(IPUKernels, CSCMatchesReference)
+{
+	SKIP_IF_UNSUPPORTED();
+	std::mt19937 rng(5678);
+
+	for (u32 iter = 0; iter < 4096; iter++)
+	{
+		RandomizeMacroblock(rng);
+
+		yuv2rgb_reference();
+		const macroblock_rgb32 expected = decoder.rgb32;
+		std::memset(&decoder.rgb32, 0, sizeof(decoder.rgb32));
+		yuv2rgb();
+
+		ASSERT_EQ(std::memcmp(&decoder.rgb32, &expected, sizeof(expected)), 0) << "iteration " << iter;
+	}
+}
+
+MULTI_ISA_TEST(IPUKernels, DitherMatchesReference)
+{
+	SKIP_IF_UNSUPPORTED();
+	std::mt19937 rng(9012);
+
+	for (u32 iter = 0; iter < 4096; iter++)
+	{
+		alignas(32) macroblock_rgb32 rgb32;
+		RandomizeRGB32(rgb32, rng);
+
+		for (const int dte : {0, 1})
+		{
+			alignas(32) macroblock_rgb16 expected;
+			alignas(32) macroblock_rgb16 actual;
+			ipu_dither_reference(rgb32, expected, dte);
+			ipu_dither(rgb32, actual, dte);
+
+			ASSERT_EQ(std::memcmp(&actual, &expected, sizeof(expected)), 0) << "iteration " << iter << " dte " << dte;
+		}
+	}
+}
+
+MULTI_ISA_TEST(IPUKernels, VQMatchesReference)
+{
+	SKIP_IF_UNSUPPORTED();
+	std::mt19937 rng(3456);
+
+	for (u32 iter = 0; iter < 1024; iter++)
+	{
+		alignas(32) macroblock_rgb16 rgb16;
+		RandomizeRGB16(rgb16, rng);
+		RandomizeCLUT(rng, iter);
+
+		u8 expected[16 * 16 / 2];
+		u8 actual[16 * 16 / 2];
+		ipu_vq_reference(rgb16, expected);
+		ipu_vq(rgb16, actual);
+
+		ASSERT_EQ(std::memcmp(actual, expected, sizeof(expected)), 0) << "iteration " << iter;
+	}
+}
+
+// Not run by default, use --gtest_also_run_disabled_tests to compare the kernels' throughput.
+MULTI_ISA_TEST(IPUKernels, DISABLED_Throughput)
+{
+	SKIP_IF_UNSUPPORTED();
+	static constexpr u32 ITERATIONS = 256 * 1024;
+
+	std::mt19937 rng(7890);
+	alignas(32) s16 block[64];
+	RandomizeBlock(block, rng, 0);
+	RandomizeMacroblock(rng);
+	RandomizeCLUT(rng, 0);
+
+	const auto measure = [](const char* name, auto&& fn) {
+		Common::Timer timer;
+		for (u32 i = 0; i < ITERATIONS; i++)
+			fn();
+
+		std::printf("%s: %.2f ns/call\n", name, timer.GetTimeNanoseconds() / ITERATIONS);
+	};
+
+	alignas(32) s16 work[64];
+	measure("IDCT (reference)", [&]() { std::memcpy(work, block, sizeof(work)); ipu_idct_reference(work); });
+	measure("IDCT", [&]() { std::memcpy(work, block, sizeof(work)); ipu_idct(work); });
+	measure("CSC (reference)", []() { yuv2rgb_reference(); });
+	measure("CSC", []() { yuv2rgb(); });
+	measure("Dither (reference)", []() { ipu_dither_reference(decoder.rgb32, decoder.rgb16, 1); });
+	measure("Dither", []() { ipu_dither(decoder.rgb32, decoder.rgb16, 1); });
+
+	u8 indx4[16 * 16 / 2];
+	measure("VQ (reference)", [&]() { ipu_vq_reference(decoder.rgb16, indx4); });
+	measure("VQ", [&]() { ipu_vq(decoder.rgb16, indx4); });
+}
+
+MULTI_ISA_UNSHARED_END
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/CycleEventQueue.h"
+#include <gtest/gtest.h>
+
+TEST(CycleEventQueue, OrdersByDeadline)
+{
+	CycleEventQueue<32> queue;
+	queue.Schedule(3, 300);
+	queue.Schedule(1, 100);
+	queue.Schedule(7, 200);
+
+	ASSERT_EQ(queue.GetNextDeadline(), 100u);
+	ASSERT_FALSE(queue.IsDue(99));
+	ASSERT_TRUE(queue.IsDue(100));
+
+	queue.Cancel(1);
+	ASSERT_EQ(queue.GetNextDeadline(), 200u);
+	queue.Cancel(7);
+	ASSERT_EQ(queue.GetNextDeadline(), 300u);
+	queue.Cancel(3);
+	ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(CycleEventQueue, Reschedule)
+{
+	CycleEventQueue<32> queue;
+	queue.Schedule(0, 100);
+	queue.Schedule(1, 200);
+	queue.Schedule(0, 300);
+	ASSERT_EQ(queue.GetNextDeadline(), 200u);
+
+	queue.Schedule(0, 50);
+	ASSERT_EQ(queue.GetNextDeadline(), 50u);
+}
+
+TEST(CycleEventQueue, PruneDropsClearedEvents)
+{
+	CycleEventQueue<32> queue;
+	queue.Schedule(2, 100);
+	queue.Schedule(4, 200);
+
+	// Event 2 was cleared without going through the queue.
+	queue.Prune(1u << 4);
+	ASSERT_EQ(queue.GetNextDeadline(), 200u);
+
+	queue.Prune(0);
+	ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(CycleEventQueue, HandlesCycleWrap)
+{
+	CycleEventQueue<32> queue;
+	queue.Schedule(0, 0x10);
+	queue.Schedule(1, 0xFFFFFFF0u);
+
+	// 0xFFFFFFF0 comes before 0x10 once the counter wraps.
+	ASSERT_EQ(queue.GetNextDeadline(), 0xFFFFFFF0u);
+	ASSERT_TRUE(queue.IsDue(0x5));
+	queue.Cancel(1);
+	ASSERT_FALSE(queue.IsDue(0x5));
+}
+
+TEST(CycleEventQueue, ManyEvents)
+{
+	CycleEventQueue<32> queue;
+	for (u32 i = 0; i < 32; i++)
+		queue.Schedule(i, ((i * 7) % 32) * 10);
+
+	u32 last = 0;
+	u32 pending = 0xFFFFFFFFu;
+	for (u32 i = 0; i < 32; i++)
+	{
+		queue.Prune(pending);
+		const u32 deadline = queue.GetNextDeadline();
+		ASSERT_GE(deadline, last);
+		last = deadline;
+
+		// Event ids are a permutation, so recover the id from the deadline.
+		for (u32 id = 0; id < 32; id++)
+		{
+			if (((id * 7) % 32) * 10 == deadline)
+				pending &= ~(1u << id);
+		}
+	}
+
+	queue.Prune(pending);
+	ASSERT_TRUE(queue.IsEmpty());
+}
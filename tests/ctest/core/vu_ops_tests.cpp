@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: 2002-2024 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Config.h"
+#include "pcsx2/VU.h"
+#include "pcsx2/VUops.h"
+
+#include "common/Timer.h"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstdio>
+#include <random>
+
+// Checks the FMAC instructions in the interpreter against a field-at-a-time reference, which is how they
+// were implemented before being vectorized.
+
+namespace
+{
+	enum class RefOp
+	{
+		Add,
+		Sub,
+		Mul,
+		MAdd,
+		MSub,
+	};
+
+	enum class RefFt
+	{
+		Vector,
+		I,
+		Q,
+		BC,
+	};
+
+	struct TestOp
+	{
+		const char* name;
+		u32 funct;
+		RefOp op;
+		RefFt ft;
+	};
+
+	static constexpr TestOp s_test_ops[] = {
+		{"ADD", 0x28, RefOp::Add, RefFt::Vector},
+		{"SUB", 0x2c, RefOp::Sub, RefFt::Vector},
+		{"MUL", 0x2a, RefOp::Mul, RefFt::Vector},
+		{"MADD", 0x29, RefOp::MAdd, RefFt::Vector},
+		{"MSUB", 0x2d, RefOp::MSub, RefFt::Vector},
+		{"ADDi", 0x22, RefOp::Add, RefFt::I},
+		{"SUBq", 0x24, RefOp::Sub, RefFt::Q},
+		{"MULi", 0x1e, RefOp::Mul, RefFt::I},
+		{"MADDq", 0x21, RefOp::MAdd, RefFt::Q},
+		{"ADDbc", 0x00, RefOp::Add, RefFt::BC},
+		{"SUBbc", 0x04, RefOp::Sub, RefFt::BC},
+		{"MADDbc", 0x08, RefOp::MAdd, RefFt::BC},
+		{"MSUBbc", 0x0c, RefOp::MSub, RefFt::BC},
+		{"MULbc", 0x18, RefOp::Mul, RefFt::BC},
+	};
+
+	static u32 RefDouble(u32 f, bool overflow)
+	{
+		const u32 exp = f & 0x7f800000;
+		if (exp == 0)
+			return f & 0x80000000;
+		if (exp == 0x7f800000 && overflow)
+			return (f & 0x80000000) | 0x7f7fffff;
+		return f;
+	}
+
+	static float RefDoubleF(u32 f, bool overflow)
+	{
+		return std::bit_cast<float>(RefDouble(f, overflow));
+	}
+
+	struct RefResult
+	{
+		u32 fields[4];
+		u32 macflag;
+		u32 statusflag;
+	};
+
+	static RefResult RunReference(const TestOp& op, const VURegs& VU, u32 code, bool vu0_overflow, bool dst_overflow)
+	{
+		const u32 fs = (code >> 11) & 0x1f;
+		const u32 ft = (code >> 16) & 0x1f;
+		const u32 xyzw = (code >> 21) & 0xf;
+
+		RefResult ret = {};
+		for (u32 i = 0; i < 4; i++)
+		{
+			const u32 shift = 3 - i;
+			if (!(xyzw & (1u << shift)))
+				continue;
+
+			u32 ft_val;
+			switch (op.ft)
+			{
+				case RefFt::Vector: ft_val = VU.VF[ft].UL[i]; break;
+				case RefFt::I: ft_val = VU.VI[REG_I].UL; break;
+				case RefFt::Q: ft_val = VU.VI[REG_Q].UL; break;
+				default: ft_val = VU.VF[ft].UL[code & 3]; break;
+			}
+
+			const float a = RefDoubleF(VU.VF[fs].UL[i], vu0_overflow);
+			const float b = RefDoubleF(ft_val, vu0_overflow);
+			const float acc = RefDoubleF(VU.ACC.UL[i], vu0_overflow);
+			float f;
+			switch (op.op)
+			{
+				case RefOp::Add: f = a + b; break;
+				case RefOp::Sub: f = a - b; break;
+				case RefOp::Mul: f = a * b; break;
+				case RefOp::MAdd: f = acc + (a * b); break;
+				default: f = acc - (a * b); break;
+			}
+
+			const u32 v = std::bit_cast<u32>(f);
+			const u32 s = v & 0x80000000;
+			const u32 exp = (v >> 23) & 0xff;
+			if (s)
+				ret.macflag |= 0x0010 << shift;
+
+			if (f == 0)
+			{
+				ret.macflag |= 0x0001 << shift;
+				ret.fields[i] = v;
+			}
+			else if (exp == 0)
+			{
+				ret.macflag |= 0x0101 << shift;
+				ret.fields[i] = s;
+			}
+			else if (exp == 255)
+			{
+				ret.macflag |= 0x1000 << shift;
+				ret.fields[i] = dst_overflow ? (s | 0x7f7fffff) : v;
+			}
+			else
+			{
+				ret.fields[i] = v;
+			}
+		}
+
+		for (u32 i = 0; i < 4; i++)
+		{
+			if (ret.macflag & (0xFu << (i * 4)))
+				ret.statusflag |= 1u << i;
+		}
+
+		return ret;
+	}
+
+	static u32 RandomOperand(std::mt19937& rng)
+	{
+		// Bias towards the values which the flags care about.
+		static constexpr u32 specials[] = {0x00000000, 0x80000000, 0x00000001, 0x807fffff, 0x7f800000, 0xff800000,
+			0x7fffffff, 0x7f7fffff, 0xff7fffff, 0x00800000, 0x80800000, 0x3f800000, 0xbf800000, 0x7e800000, 0x01000000};
+
+		const u32 r = rng();
+		if ((r & 3) == 0)
+			return specials[(r >> 2) % std::size(specials)];
+		return rng();
+	}
+
+	static void RandomizeRegisters(VURegs& VU, std::mt19937& rng)
+	{
+		for (u32 i = 1; i < 32; i++)
+		{
+			for (u32 j = 0; j < 4; j++)
+				VU.VF[i].UL[j] = RandomOperand(rng);
+		}
+		for (u32 j = 0; j < 4; j++)
+			VU.ACC.UL[j] = RandomOperand(rng);
+		VU.VI[REG_I].UL = RandomOperand(rng);
+		VU.VI[REG_Q].UL = RandomOperand(rng);
+	}
+
+	static u32 EncodeUpper(u32 funct, u32 fd, u32 fs, u32 ft, u32 xyzw)
+	{
+		return (xyzw << 21) | (ft << 16) | (fs << 11) | (fd << 6) | funct;
+	}
+
+	static void CheckUnit(u32 unit)
+	{
+		VURegs& VU = vuRegs[unit];
+		const FnPtr_VuVoid* table = unit ? VU1_UPPER_OPCODE : VU0_UPPER_OPCODE;
+		std::mt19937 rng(1234 + unit);
+
+		for (const bool overflow : {false, true})
+		{
+			EmuConfig.Cpu.Recompiler.vu0Overflow = overflow;
+			EmuConfig.Cpu.Recompiler.vu1Overflow = overflow;
+
+			for (const TestOp& op : s_test_ops)
+			{
+				for (u32 iter = 0; iter < 2048; iter++)
+				{
+					RandomizeRegisters(VU, rng);
+
+					const u32 bc = (op.ft == RefFt::BC) ? (rng() & 3) : 0;
+					const u32 fd = 1 + (rng() % 31);
+					const u32 fs = 1 + (rng() % 31);
+					const u32 ft = 1 + (rng() % 31);
+					const u32 xyzw = rng() & 0xf;
+					const u32 code = EncodeUpper(op.funct + bc, fd, fs, ft, xyzw);
+
+					VECTOR old_fd = VU.VF[fd];
+					const RefResult expected = RunReference(op, VU, code, overflow, overflow);
+
+					VU.code = code;
+					VU.macflag = rng() & 0xffff;
+					VU.statusflag = rng() & 0xf;
+					table[code & 0x3f]();
+
+					for (u32 i = 0; i < 4; i++)
+					{
+						const u32 want = (xyzw & (8u >> i)) ? expected.fields[i] : old_fd.UL[i];
+						ASSERT_EQ(VU.VF[fd].UL[i], want) << op.name << " VU" << unit << " field " << i << " code " << std::hex << code;
+					}
+					ASSERT_EQ(VU.macflag, expected.macflag) << op.name << " VU" << unit << " code " << std::hex << code;
+					ASSERT_EQ(VU.statusflag, expected.statusflag) << op.name << " VU" << unit << " code " << std::hex << code;
+				}
+			}
+		}
+
+		EmuConfig.Cpu.Recompiler.vu0Overflow = Pcsx2Config::RecompilerOptions().vu0Overflow;
+		EmuConfig.Cpu.Recompiler.vu1Overflow = Pcsx2Config::RecompilerOptions().vu1Overflow;
+	}
+} // namespace
+
+TEST(VUInterpreter, FMACMatchesReferenceVU0)
+{
+	CheckUnit(0);
+}
+
+TEST(VUInterpreter, FMACMatchesReferenceVU1)
+{
+	CheckUnit(1);
+}
+
+// Not run by default, use --gtest_also_run_disabled_tests to compare the units' upper instruction throughput.
+TEST(VUInterpreter, DISABLED_FMACThroughput)
+{
+	static constexpr u32 ITERATIONS = 4 * 1024 * 1024;
+	static constexpr u32 funcs[] = {0x28, 0x2a, 0x29, 0x22, 0x08};
+
+	for (u32 unit = 0; unit < 2; unit++)
+	{
+		VURegs& VU = vuRegs[unit];
+		const FnPtr_VuVoid* table = unit ? VU1_UPPER_OPCODE : VU0_UPPER_OPCODE;
+		std::mt19937 rng(5678);
+		RandomizeRegisters(VU, rng);
+
+		for (const u32 funct : funcs)
+		{
+			VU.code = EncodeUpper(funct, 1 + (funct & 7), 9, 10, 0xf);
+
+			Common::Timer timer;
+			for (u32 i = 0; i < ITERATIONS; i++)
+				table[funct]();
+
+			const double ns = timer.GetTimeNanoseconds() / ITERATIONS;
+			std::printf("VU%u upper 0x%02X: %.2f ns/op\n", unit, funct, ns);
+		}
+	}
+}